@@ -68,14 +68,11 @@ void Card::play()
     return;
   }
 
-  Card *card = currentPlayer->getHand()->removeCard(cardType);
-
-  if (card == nullptr)
+  if (!currentPlayer->getHand()->removeCard(cardType))
   {
     throw std::runtime_error("Hand did not contain card type: " + Card::CardTypeToString(cardType));
   }
-  Deck *gameDeck = game->getDeck();
-  gameDeck->addCardToDeck(card);
+  game->getDeck()->addCardToDeck(cardType);
 }
 
 /**
@@ -118,96 +115,99 @@ std::string Card::getCardTypeString()
 Card::~Card() = default;
 
 /**
- * @brief Copy constructor for the Hand class.
- * @param initial The Hand object to be copied.
+ * @brief Default constructor for the Hand class.
+ */
+// Default constructor
+Hand::Hand() = default;
+
+/**
+ * @brief Add a card of the given type to the hand.
+ * @param type The type of the card to be added.
  */
-// Copy construct
-Hand::Hand(const Hand &initial)
+void Hand::addToHand(CardType type)
 {
-  for (auto &&temp : initial.handCards)
-  {
-    handCards.push_back(new Card(*temp));
-  }
+  counts[type]++;
+  cardCount++;
 }
 
 /**
- * @brief Destructor for the Hand class.
+ * @brief Add a card to the hand. The hand only keeps the type and deletes the card.
+ * @param card Pointer to the card to be added.
+ * @throw std::invalid_argument if the card is nullptr.
  */
-// Destructor
-Hand::~Hand()
+void Hand::addToHand(Card *card)
 {
-  for (auto card : handCards)
+  if (card == nullptr)
   {
-    delete card;
+    throw std::invalid_argument("Card is a nullptr.");
   }
-  handCards.clear();
+  addToHand(card->getCardType());
+  delete card;
 }
 
 /**
- * @brief Get a pointer to the vector of cards in the hand.
- * @return Pointer to the vector of cards.
+ * @brief Remove a card of the specified type from the hand.
+ * @param type The type of the card to be removed.
+ * @return True if a card was removed, false if the hand had none of that type.
  */
-std::vector<Card *> *Hand::getCards()
+bool Hand::removeCard(CardType type)
 {
-  return &this->handCards;
+  if (counts[type] == 0)
+  {
+    return false;
+  }
+  counts[type]--;
+  cardCount--;
+  return true;
 }
 
 /**
- * @brief Get a card from the hand at a specific index.
- * @param index The index of the card to retrieve.
- * @return The card at the specified index.
+ * @brief Get the type of a card from its index in the hand, cards being ordered by type.
+ * @param index The index of the card.
+ * @return The type of the card at the specified index.
  * @throw std::invalid_argument if the index is out of range.
  */
-Card *Hand::getCardFromHand(int index)
+CardType Hand::getCardTypeAt(int index) const
 {
-  if (index < 0 || index >= handCards.size())
+  if (index < 0 || index >= cardCount)
   {
     throw std::invalid_argument("Index out of range.");
   }
-  return handCards.at(index);
+  int type = 0;
+  while (index >= counts[type])
+  {
+    index -= counts[type];
+    type++;
+  }
+  return (CardType)type;
 }
 
 /**
- * @brief Add a card to the hand.
- * @param card Pointer to the card to be added.
- * @throw std::invalid_argument if the card is nullptr.
+ * @brief Get the number of cards of a type in the hand.
+ * @param type The type of the card.
+ * @return The number of cards of that type.
  */
-void Hand::addToHand(Card *card)
+int Hand::count(CardType type) const
 {
-  if (card == nullptr)
-  {
-    throw std::invalid_argument("Card is a nullptr.");
-  }
-  handCards.push_back(card);
+  return counts[type];
 }
 
 /**
- * @brief Remove a card of the specified type from the hand.
- * @param type The type of the card to be removed.
- * @return Pointer to the removed card or nullptr if not found.
+ * @brief Get the number of cards in the hand.
+ * @return The number of cards.
  */
-Card *Hand::removeCard(CardType type)
+int Hand::size() const
 {
-  for (int i = 0; i < handCards.size(); i++)
-  {
-    auto cardType = handCards.at(i)->getCardType();
-    if (cardType == (int)type)
-    {
-      Card *card = handCards.at(i);
-      handCards.erase(handCards.begin() + i);
-      return card;
-    }
-  }
-  return nullptr;
+  return cardCount;
 }
 
 /**
- * @brief Default constructor for the Hand class.
+ * @brief Check whether the hand holds no card.
+ * @return True if the hand is empty, false otherwise.
  */
-// Default constructor
-Hand::Hand()
+bool Hand::empty() const
 {
-  handCards = vector<Card *>();
+  return cardCount == 0;
 }
 
 /**
@@ -226,134 +226,139 @@ Deck::Deck(GameEngine *game)
 }
 
 /**
- * @brief Destructor for the Deck class.
+ * @brief Draw a card from the deck and add it to the specified hand.
+ * @param currentHand The hand to which the card will be added.
+ * @throw std::runtime_error if the deck is empty.
  */
-// Destructor
-Deck::~Deck()
+// Draw card from the deck of hand
+void Deck::draw(Hand &currentHand)
 {
-  for (auto card : deckCards)
+  if (cards.empty())
   {
-    delete card;
+    throw std::runtime_error("The deck is currently empty.");
   }
-  deckCards.clear();
+  currentHand.addToHand(removeCardRandom());
 }
 
 /**
- * @brief Copy constructor for the Deck class.
- * @param initial The Deck object to be copied.
+ * @brief Shuffle the deck of cards with the game's random number generator.
  */
-// Copy constructor
-Deck::Deck(const Deck &initial)
+// Method shuffling the deck of hand
+void Deck::shuffleDeck()
 {
-  this->game = initial.game;
-  for (auto &&temp : initial.deckCards)
-  {
-    deckCards.push_back(new Card(*temp));
-  }
+  std::shuffle(cards.begin(), cards.end(), game->getRng());
 }
 
 /**
- * @brief Draw a card from the deck and add it to the specified hand.
- * @param currentHand The hand to which the card will be added.
- * @throw std::runtime_error if the deck is empty.
+ * @brief Add a card of the given type to the deck.
+ * The card is appended and swapped with a uniformly chosen position, which keeps a shuffled deck shuffled.
+ * @param type The type of the card to be added.
  */
-// Draw card from the deck of hand
-void Deck::draw(Hand &currentHand)
+void Deck::addCardToDeck(CardType type)
+{
+  cards.push_back((uint8_t)type);
+  counts[type]++;
+  size_t position = std::uniform_int_distribution<size_t>(0, cards.size() - 1)(game->getRng());
+  std::swap(cards[position], cards.back());
+}
+
+/**
+ * @brief Add a card to the deck. The deck only keeps the type and deletes the card.
+ * @param card Pointer to the card to be added.
+ * @throw std::invalid_argument if the card is nullptr.
+ */
+void Deck::addCardToDeck(Card *card)
 {
-  if (deckCards.empty())
+  if (card == nullptr)
   {
-    throw std::runtime_error("The deck is currently empty.");
+    throw std::invalid_argument("Card is a nullptr.");
   }
-  Card *c = removeCardRandom();
-  currentHand.addToHand(c);
+  addCardToDeck(card->getCardType());
+  delete card;
 }
 
 /**
- * @brief Shuffle the deck of cards.
+ * @brief Remove the top card of the deck. The deck is kept shuffled, so this is a random card.
+ * @return The type of the removed card.
  */
-// Method shuffling the deck of hand
-void Deck::shuffleDeck()
+CardType Deck::removeCardRandom()
 {
-  std::mt19937 rng(std::chrono::high_resolution_clock::now().time_since_epoch().count());
-  std::shuffle(std::begin(deckCards), std::end(deckCards), rng);
+  CardType type = (CardType)cards.back();
+  cards.pop_back();
+  counts[type]--;
+  return type;
 }
 
 /**
- * @brief Add a card to the deck.
- * @param card
+ * @brief Get the number of cards of a type in the deck.
+ * @param type The type of the card.
+ * @return The number of cards of that type.
+ */
+int Deck::count(CardType type) const
+{
+  return counts[type];
+}
 
- Pointer to the card to be added.
+/**
+ * @brief Get the number of cards in the deck.
+ * @return The number of cards.
  */
-void Deck::addCardToDeck(Card *card)
+int Deck::size() const
 {
-  deckCards.push_back(card);
+  return (int)cards.size();
 }
 
 /**
- * @brief Remove a card randomly from the deck.
- * @return Pointer to the removed card.
+ * @brief Check whether the deck holds no card.
+ * @return True if the deck is empty, false otherwise.
  */
-Card *Deck::removeCardRandom()
+bool Deck::empty() const
 {
-  // randomly get a card from the deck
-  std::random_device dev;
-  std::mt19937 rng(dev());
-  std::uniform_int_distribution<std::mt19937::result_type> range_deck(0, deckCards.size() - 1);
-  int index = (int)range_deck(rng);
+  return cards.empty();
+}
 
-  Card *c = deckCards.at(index);
-  // remove the card ptr from the deck
-  deckCards.erase(deckCards.begin() + index);
-  return c;
+/**
+ * @brief Get the cards in draw order.
+ * @return The card types, the last one being drawn first.
+ */
+std::vector<CardType> Deck::getDrawOrder() const
+{
+  std::vector<CardType> order;
+  order.reserve(cards.size());
+  for (uint8_t card : cards)
+  {
+    order.push_back((CardType)card);
+  }
+  return order;
 }
 
 /**
- * @brief Get a pointer to the vector of cards in the deck.
- * @return Pointer to the vector of cards.
+ * @brief Replace the deck with the given cards, kept in that order.
+ * @param order The card types, the last one being drawn first.
  */
-std::vector<Card *> *Deck::getDeckCards()
+void Deck::setDrawOrder(const std::vector<CardType> &order)
 {
-  return &this->deckCards;
+  cards.clear();
+  counts.fill(0);
+  for (CardType type : order)
+  {
+    cards.push_back((uint8_t)type);
+    counts[type]++;
+  }
 }
 
 /**
  * @brief Create a deck of cards for testing purposes.
  *
- * Assigns 40 cards in deck vector, each type having 8 cards (5 types).
+ * Adds 40 cards to the deck, 8 of each of the 5 types, then shuffles it once.
  */
 // For the testing purpose
 void Deck::create_deck()
 {
-  // Assign 40 cards in deck vector, each type has 8 cards, 5 types
-  for (int i = 0; i < 8; i++)
+  for (int type = 0; type < CARD_TYPE_COUNT; type++)
   {
-    for (int j = 0; j < 5; j++)
-    {
-      // Type 1 = Bomb
-      if (j == 0)
-      {
-        deckCards.push_back(new Card(CardType::CT_Bomb, game));
-      }
-      // Type 2 = Reinforcement
-      else if (j == 1)
-      {
-        deckCards.push_back(new Card(CardType::CT_Reinforcement, game));
-      }
-      // Type 3 = Blockade
-      else if (j == 2)
-      {
-        deckCards.push_back(new Card(CardType::CT_Blockade, game));
-      }
-      // Type 4 = Airlift
-      else if (j == 3)
-      {
-        deckCards.push_back(new Card(CardType::CT_Airlift, game));
-      }
-      // Type 5 = Diplomacy
-      else if (j == 4)
-      {
-        deckCards.push_back(new Card(CardType::CT_Diplomacy, game));
-      }
-    }
+    cards.insert(cards.end(), 8, (uint8_t)type);
+    counts[type] += 8;
   }
+  shuffleDeck();
 }
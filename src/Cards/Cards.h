@@ -3,7 +3,9 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <random>
 
 #include "Map/Map.h"
@@ -27,8 +29,14 @@ enum CardType : int
   CT_Diplomacy
 };
 
+/** @brief Number of card types. */
+const int CARD_TYPE_COUNT = 5;
+
 /**
  * @brief Class representing a Card in the game.
+ *
+ * Cards are small values: hands and decks only store counts per type, and a Card is built on the stack
+ * when one is played.
  */
 class Card
 {
@@ -112,12 +120,18 @@ public:
 
 /**
  * @brief Class representing a Hand of cards for a player.
+ *
+ * Cards only differ by their type, so the hand keeps a count per type: adding and removing a card is O(1)
+ * and never allocates. Cards are indexed in type order, e.g. every Bomb comes before the first Reinforcement.
  */
 class Hand
 {
 private:
-  /** @brief Vector of pointers to Card objects. */
-  std::vector<Card *> handCards;
+  /** @brief Number of cards of each type. */
+  std::array<int, CARD_TYPE_COUNT> counts{};
+
+  /** @brief Total number of cards. */
+  int cardCount = 0;
 
 public:
   // --------------------------------
@@ -128,69 +142,77 @@ public:
    */
   Hand();
 
+  // --------------------------------
+  // Public Methods
+  // --------------------------------
   /**
-   * @brief Destructor for Hand class.
+   * @brief Adds a card of the given type to the hand.
+   *
+   * @param type Type of the card to be added.
    */
-  ~Hand();
+  void addToHand(CardType type);
 
   /**
-   * @brief Copy constructor for Hand class.
+   * @brief Adds a card to the hand. The hand takes ownership of the card and deletes it.
    *
-   * @param initial The Hand object to be copied.
+   * @param card Pointer to the Card object to be added.
    */
-  Hand(const Hand &initial);
+  void addToHand(Card *card);
 
-  // --------------------------------
-  // Public Methods
-  // --------------------------------
   /**
-   * @brief Gets the vector of pointers to Card objects in the hand.
+   * @brief Removes a card of the given type from the hand.
    *
-   * @return Vector of pointers to Card objects.
+   * @param type Type of the card to be removed.
+   * @return True if the hand held a card of that type, false otherwise.
    */
-  std::vector<Card *> *getCards();
+  bool removeCard(CardType type);
 
   /**
-   * @brief Gets a specific card from the hand based on its index.
+   * @brief Gets the type of a card from its index in the hand.
    *
    * @param index Index of the card in the hand.
-   * @return Pointer to the Card object.
+   * @return Type of the card.
    */
-  Card *getCardFromHand(int index);
+  CardType getCardTypeAt(int index) const;
 
   /**
-   * @brief Adds a card to the hand.
+   * @brief Gets the number of cards of a type in the hand.
    *
-   * @param card Pointer to the Card object to be added.
+   * @param type Type of the card.
+   * @return Number of cards of that type.
    */
-  void addToHand(Card *card);
+  int count(CardType type) const;
 
   /**
-   * @brief Removes and deletes a card from the hand.
+   * @brief Gets the number of cards in the hand.
    *
-   * Once the card is used, it should be deleted.
-   *
-   * @param type Type of the card to be removed.
-   * @return Pointer to the removed Card object.
+   * @return Number of cards.
    */
-  Card *removeCard(CardType type);
+  int size() const;
 
   /**
-   * @brief Gets the vector of pointers to Card objects in the hand.
+   * @brief Checks whether the hand holds no card.
    *
-   * @return Vector of pointers to Card objects.
+   * @return True if the hand is empty, false otherwise.
    */
-  std::vector<Card *>* getHandCards() { return &handCards; }
+  bool empty() const;
 };
 
 /**
  * @brief Class representing a Deck of cards in the game.
+ *
+ * The deck is kept shuffled with the game's seeded random number generator: draws pop the top card in O(1), and a
+ * returned card is inserted at a random position with one Fisher-Yates step, so the order stays uniformly random
+ * and a game seed always deals the same cards. A count per type answers count() without a scan.
  */
 class Deck
 {
 private:
-  /** @brief Vector of pointers to Card objects. */
-  std::vector<Card *> deckCards;
+  /** @brief Card types in deck order, the top of the deck being the back. */
+  std::vector<uint8_t> cards;
+
+  /** @brief Number of cards of each type. */
+  std::array<int, CARD_TYPE_COUNT> counts{};
 
   /** @brief Object owner (GameEngine). */
   GameEngine *game;
@@ -206,18 +228,6 @@ public:
    */
   explicit Deck(GameEngine *);
 
-  /**
-   * @brief Destructor for Deck class.
-   */
-  ~Deck();
-
-  /**
-   * @brief Copy constructor for Deck class.
-   *
-   * @param initial The Deck object to be copied.
-   */
-  Deck(const Deck &initial);
-
   // --------------------------------
   // Public Methods
   // --------------------------------
@@ -228,33 +238,71 @@ public:
    */
   void draw(Hand &currentHand);
 
-    //deck of hand shuffler method
-    void shuffleDeck();
+  /**
+   * @brief Shuffles the whole deck with the game's random number generator.
+   */
+  void shuffleDeck();
 
   /**
-   * @brief Gets the vector of pointers to Card objects in the deck.
+   * @brief Adds a card of the given type to the deck, at a random position.
    *
-   * @return Vector of pointers to Card objects.
+   * @param type Type of the card to be added.
    */
-  std::vector<Card *> *getDeckCards();
+  void addCardToDeck(CardType type);
 
   /**
-   * @brief Adds a card to the deck.
+   * @brief Adds a card to the deck. The deck takes ownership of the card and deletes it.
    *
    * @param card Pointer to the Card object to be added.
    */
   void addCardToDeck(Card *card);
 
   /**
-   * @brief Creates the initial deck of cards for the game.
+   * @brief Gets the number of cards of a type in the deck.
+   *
+   * @param type Type of the card.
+   * @return Number of cards of that type.
+   */
+  int count(CardType type) const;
+
+  /**
+   * @brief Gets the number of cards in the deck.
+   *
+   * @return Number of cards.
+   */
+  int size() const;
+
+  /**
+   * @brief Checks whether the deck holds no card.
+   *
+   * @return True if the deck is empty, false otherwise.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Gets the cards in draw order, the last one being drawn first.
+   *
+   * @return The card types.
+   */
+  std::vector<CardType> getDrawOrder() const;
+
+  /**
+   * @brief Replaces the deck with the given cards, kept in that order.
+   *
+   * @param order The card types, the last one being drawn first.
+   */
+  void setDrawOrder(const std::vector<CardType> &order);
+
+  /**
+   * @brief Creates the initial deck of cards for the game, shuffled.
    */
   void create_deck();
 
 private:
   /**
-   * @brief Removes a card from the deck at random.
+   * @brief Removes the top card of the deck.
    *
-   * @return Pointer to the removed Card object.
+   * @return Type of the removed card.
    */
-  Card *removeCardRandom();
-};
\ No newline at end of file
+  CardType removeCardRandom();
+};
@@ -16,21 +16,17 @@ void testCards(int argc, char **argv)
 
   cout << "-> Adding 10 cards to deck..." << endl;
   // initialize deck (10 cards)
-  deck->addCardToDeck(new Card(CT_Bomb, gameEngine));
-  deck->addCardToDeck(new Card(CT_Diplomacy, gameEngine));
-  deck->addCardToDeck(new Card(CT_Airlift, gameEngine));
-  deck->addCardToDeck(new Card(CT_Blockade, gameEngine));
-  deck->addCardToDeck(new Card(CT_Diplomacy, gameEngine));
-
-  deck->addCardToDeck(new Card(CT_Bomb, gameEngine));
-  deck->addCardToDeck(new Card(CT_Diplomacy, gameEngine));
-  deck->addCardToDeck(new Card(CT_Bomb, gameEngine));
-  deck->addCardToDeck(new Card(CT_Blockade, gameEngine));
-  deck->addCardToDeck(new Card(CT_Airlift, gameEngine));
-
-  cout << "-> shuffling deck..." << endl;
-  // Creating a deck of all hand mixed
-  deck->shuffleDeck();
+  deck->addCardToDeck(CT_Bomb);
+  deck->addCardToDeck(CT_Diplomacy);
+  deck->addCardToDeck(CT_Airlift);
+  deck->addCardToDeck(CT_Blockade);
+  deck->addCardToDeck(CT_Diplomacy);
+
+  deck->addCardToDeck(CT_Bomb);
+  deck->addCardToDeck(CT_Diplomacy);
+  deck->addCardToDeck(CT_Bomb);
+  deck->addCardToDeck(CT_Blockade);
+  deck->addCardToDeck(CT_Airlift);
 
   // getting the hand obj
   auto player_hand = player->getHand();
@@ -44,20 +40,20 @@ void testCards(int argc, char **argv)
 
   cout << "-> Card in player's hand" << endl;
 
-  for (auto handCard : *player_hand->getHandCards())
+  for (int i = 0; i < player_hand->size(); i++)
   {
-    cout << handCard->getCardType() << endl;
+    cout << player_hand->getCardTypeAt(i) << endl;
   }
 
-  cout << "-> Number of Cards in Deck: " << deck->getDeckCards()->size() << endl;
-  cout << "-> Number of Cards in Player's hand: " << player_hand->getHandCards()->size() << endl;
+  cout << "-> Number of Cards in Deck: " << deck->size() << endl;
+  cout << "-> Number of Cards in Player's hand: " << player_hand->size() << endl;
 
   cout << "-> Player Plays a card" << endl;
   gameEngine->setCurrentPlayer(player);
   // play most left hand size card
-  Card *card_to_play = player_hand->getHandCards()->at(0);
-  card_to_play->play();
+  Card card_to_play(player_hand->getCardTypeAt(0), gameEngine);
+  card_to_play.play();
 
-  cout << "-> Number of Cards in Deck: " << deck->getDeckCards()->size() << endl;
-  cout << "-> Number of Cards in Player's hand: " << player_hand->getHandCards()->size() << endl;
+  cout << "-> Number of Cards in Deck: " << deck->size() << endl;
+  cout << "-> Number of Cards in Player's hand: " << player_hand->size() << endl;
 }
@@ -0,0 +1,242 @@
+#include "BinaryCodec.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Appends a single byte.
+ * @param value The byte.
+ */
+void BinaryWriter::byte(uint8_t value)
+{
+  bytes += (char)value;
+}
+
+/**
+ * @brief Appends an unsigned integer as a LEB128 varint.
+ * @param value The value.
+ */
+void BinaryWriter::varint(uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    bytes += (char)(value | 0x80);
+    value >>= 7;
+  }
+  bytes += (char)value;
+}
+
+/**
+ * @brief Appends a signed integer as a zigzag-encoded varint.
+ * @param value The value.
+ */
+void BinaryWriter::signedVarint(int32_t value)
+{
+  varint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+/**
+ * @brief Appends a 64-bit value as 8 little-endian bytes, for hashes that would not shrink as varints.
+ * @param value The value.
+ */
+void BinaryWriter::fixed64(uint64_t value)
+{
+  for (int i = 0; i < 8; i++)
+  {
+    bytes += (char)(value >> (8 * i));
+  }
+}
+
+/**
+ * @brief Appends a string as its length followed by its bytes.
+ * @param value The string.
+ */
+void BinaryWriter::string(const std::string &value)
+{
+  varint(value.size());
+  bytes += value;
+}
+
+/**
+ * @brief Constructor for BinaryReader.
+ * @param begin The first byte to read.
+ * @param end The end of the bytes.
+ * @param owner The name used to prefix errors.
+ */
+BinaryReader::BinaryReader(const uint8_t *begin, const uint8_t *end, const char *owner)
+    : at(begin), end(end), owner(owner)
+{
+}
+
+/**
+ * @brief Checks whether every byte was read.
+ * @return True at the end of the bytes, false otherwise.
+ */
+bool BinaryReader::done() const
+{
+  return at == end;
+}
+
+/**
+ * @brief Throws an error prefixed with the owner's name.
+ * @param message The error message.
+ * @throws std::runtime_error always.
+ */
+void BinaryReader::fail(const std::string &message) const
+{
+  throw std::runtime_error(std::string(owner) + "::Error | " + message);
+}
+
+/**
+ * @brief Reads a single byte.
+ * @return The byte.
+ */
+uint8_t BinaryReader::byte()
+{
+  if (at == end)
+  {
+    fail("The file is truncated");
+  }
+  return *at++;
+}
+
+/**
+ * @brief Reads a LEB128 varint.
+ * @return The value.
+ */
+uint64_t BinaryReader::varint()
+{
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    uint8_t b = byte();
+    value |= (uint64_t)(b & 0x7F) << shift;
+    if (b < 0x80)
+    {
+      return value;
+    }
+  }
+  fail("Malformed integer");
+}
+
+/**
+ * @brief Reads the number of elements of a list, before anything is allocated for them.
+ * @param minBytes The fewest bytes a single element takes in the file.
+ * @return The number of elements.
+ * @throws std::runtime_error if the remaining bytes cannot hold that many elements.
+ */
+uint64_t BinaryReader::count(size_t minBytes)
+{
+  uint64_t value = varint();
+  if (value > (uint64_t)(end - at) / minBytes)
+  {
+    fail("The file is truncated");
+  }
+  return value;
+}
+
+/**
+ * @brief Reads a zigzag-encoded varint.
+ * @return The value.
+ */
+int32_t BinaryReader::signedVarint()
+{
+  uint32_t value = (uint32_t)varint();
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+/**
+ * @brief Reads 8 little-endian bytes.
+ * @return The value.
+ */
+uint64_t BinaryReader::fixed64()
+{
+  uint64_t value = 0;
+  for (int i = 0; i < 8; i++)
+  {
+    value |= (uint64_t)byte() << (8 * i);
+  }
+  return value;
+}
+
+/**
+ * @brief Reads a string written as its length followed by its bytes.
+ * @return The string.
+ */
+std::string BinaryReader::string()
+{
+  uint64_t length = varint();
+  if (length > (uint64_t)(end - at))
+  {
+    fail("The file is truncated");
+  }
+  std::string value((const char *)at, length);
+  at += length;
+  return value;
+}
+
+/**
+ * @brief Reads a whole binary file.
+ * @param fileName The file to read.
+ * @param owner The name used to prefix the error.
+ * @return The bytes of the file.
+ * @throws std::runtime_error if the file cannot be opened.
+ */
+std::vector<uint8_t> readBinaryFile(const std::string &fileName, const char *owner)
+{
+  std::ifstream file(fileName, std::ios::in | std::ios::binary);
+  if (!file)
+  {
+    throw std::runtime_error(std::string(owner) + "::Error | Cannot open " + fileName);
+  }
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Moves a file over another one, replacing it if it exists.
+ * @param from The file to move.
+ * @param to The file to replace.
+ * @return True if the file was moved, false otherwise.
+ */
+bool replaceFile(const std::string &from, const std::string &to)
+{
+#ifdef _WIN32
+  return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+/**
+ * @brief Cuts a file down to a given length.
+ * @param fileName The file to shorten.
+ * @param length The length to keep, in bytes.
+ * @return True if the file was shortened, false otherwise.
+ */
+bool truncateFile(const std::string &fileName, uint64_t length)
+{
+#ifdef _WIN32
+  HANDLE file = CreateFileA(fileName.c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  LARGE_INTEGER position;
+  position.QuadPart = (LONGLONG)length;
+  bool truncated = SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+  CloseHandle(file);
+  return truncated;
+#else
+  return truncate(fileName.c_str(), (off_t)length) == 0;
+#endif
+}
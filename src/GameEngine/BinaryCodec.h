@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Appends integers and strings to a byte buffer in the compact form used by replay and checkpoint files.
+ *
+ * Integers are written as LEB128 varints, signed ones zigzag-encoded first so small negative values stay short.
+ * Strings are written as their length followed by their bytes.
+ */
+struct BinaryWriter
+{
+  std::string bytes;
+
+  void byte(uint8_t value);
+  void varint(uint64_t value);
+  void signedVarint(int32_t value);
+  void fixed64(uint64_t value);
+  void string(const std::string &value);
+};
+
+/**
+ * @brief Bounds-checked reader for the bytes written by a BinaryWriter.
+ *
+ * Reading past the end or a malformed varint throws a std::runtime_error prefixed with the name of the reader's
+ * owner, e.g. "ReplayPlayer::Error | The file is truncated".
+ */
+struct BinaryReader
+{
+  const uint8_t *at;
+  const uint8_t *end;
+  const char *owner;
+
+  BinaryReader(const uint8_t *begin, const uint8_t *end, const char *owner);
+
+  bool done() const;
+  [[noreturn]] void fail(const std::string &message) const;
+
+  uint8_t byte();
+  uint64_t varint();
+  uint64_t count(size_t minBytes);
+  int32_t signedVarint();
+  uint64_t fixed64();
+  std::string string();
+};
+
+/**
+ * @brief Reads a whole binary file.
+ *
+ * @param fileName The file to read.
+ * @param owner The name used to prefix the error.
+ * @return The bytes of the file.
+ * @throws std::runtime_error if the file cannot be opened.
+ */
+std::vector<uint8_t> readBinaryFile(const std::string &fileName, const char *owner);
+
+/**
+ * @brief Moves a file over another one, replacing it if it exists.
+ *
+ * std::rename refuses to replace an existing file on Windows, so files written to "<file>.tmp" and then moved over
+ * the previous version go through this instead.
+ *
+ * @param from The file to move.
+ * @param to The file to replace.
+ * @return True if the file was moved, false otherwise.
+ */
+bool replaceFile(const std::string &from, const std::string &to);
+
+/**
+ * @brief Cuts a file down to a given length, without reading it.
+ *
+ * @param fileName The file to shorten.
+ * @param length The length to keep, in bytes.
+ * @return True if the file was shortened, false otherwise.
+ */
+bool truncateFile(const std::string &fileName, uint64_t length);
@@ -0,0 +1,336 @@
+#include "CommandParser.h"
+
+#include <climits>
+#include <cstring>
+
+/**
+ * @brief A token of the command line, pointing into the input.
+ */
+struct CommandToken
+{
+  const char *begin = nullptr;
+  size_t length = 0;
+  size_t position = 0;
+
+  bool empty() const { return length == 0; }
+  bool is(const char *word) const { return length == strlen(word) && memcmp(begin, word, length) == 0; }
+  bool isOption() const { return length == 2 && begin[0] == '-'; }
+  std::string str() const { return std::string(begin, length); }
+};
+
+/**
+ * @brief Splits a command line into whitespace separated tokens, one at a time.
+ */
+class CommandLexer
+{
+private:
+  const std::string &input;
+  size_t cursor = 0;
+
+  static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v'; }
+
+  void skipSpaces()
+  {
+    while (cursor < input.size() && isSpace(input[cursor]))
+    {
+      cursor++;
+    }
+  }
+
+public:
+  explicit CommandLexer(const std::string &input) : input(input) {}
+
+  /**
+   * @brief Reads the next token. Returns an empty token at the end of the input.
+   */
+  CommandToken next()
+  {
+    skipSpaces();
+    CommandToken token;
+    token.begin = input.data() + cursor;
+    token.position = cursor;
+    while (cursor < input.size() && !isSpace(input[cursor]))
+    {
+      cursor++;
+    }
+    token.length = cursor - token.position;
+    return token;
+  }
+
+  /**
+   * @brief Looks at the next token without consuming it.
+   */
+  CommandToken peek()
+  {
+    size_t saved = cursor;
+    CommandToken token = next();
+    cursor = saved;
+    return token;
+  }
+
+  /**
+   * @brief Returns everything left on the line, without surrounding whitespace.
+   */
+  CommandToken rest()
+  {
+    skipSpaces();
+    size_t end = input.size();
+    while (end > cursor && isSpace(input[end - 1]))
+    {
+      end--;
+    }
+    CommandToken token;
+    token.begin = input.data() + cursor;
+    token.position = cursor;
+    token.length = end - cursor;
+    cursor = input.size();
+    return token;
+  }
+
+  /**
+   * @brief Gets the position just past the last consumed character.
+   */
+  size_t position() const { return cursor; }
+};
+
+/**
+ * @brief Marks a command as invalid.
+ *
+ * @param command The command being parsed.
+ * @param position The 0-based column of the error.
+ * @param error Description of the error.
+ * @return The invalid command.
+ */
+static ParsedCommand &fail(ParsedCommand &command, size_t position, const std::string &error)
+{
+  command.error = error;
+  command.errorPosition = position;
+  return command;
+}
+
+/**
+ * @brief Parses a non-negative decimal integer token.
+ *
+ * @param token The token to parse.
+ * @param out The parsed value.
+ * @return True if the whole token is a number that fits in an int, false otherwise.
+ */
+static bool parseNumber(const CommandToken &token, int &out)
+{
+  if (token.empty())
+  {
+    return false;
+  }
+  long long value = 0;
+  for (size_t i = 0; i < token.length; i++)
+  {
+    char c = token.begin[i];
+    if (c < '0' || c > '9')
+    {
+      return false;
+    }
+    value = value * 10 + (c - '0');
+    if (value > INT_MAX)
+    {
+      return false;
+    }
+  }
+  out = (int)value;
+  return true;
+}
+
+/**
+ * @brief Checks that nothing follows a command that takes no arguments.
+ *
+ * @param lexer The lexer positioned after the command word.
+ * @param command The command being parsed.
+ * @return The command, invalid if extra arguments were found.
+ */
+static ParsedCommand &expectEnd(CommandLexer &lexer, ParsedCommand &command)
+{
+  CommandToken extra = lexer.next();
+  if (!extra.empty())
+  {
+    return fail(command, extra.position, "unexpected argument \"" + extra.str() + "\"");
+  }
+  return command;
+}
+
+/**
+ * @brief Parses the options of a tournament command. -O and -F are optional, every other option is required.
+ *
+ * @param lexer The lexer positioned after "tournament".
+ * @param command The command being parsed.
+ * @return The command, invalid if an option is malformed or missing.
+ */
+static ParsedCommand &parseTournament(CommandLexer &lexer, ParsedCommand &command)
+{
+  bool seenMaps = false, seenStrategies = false, seenGames = false, seenTurns = false;
+
+  for (CommandToken option = lexer.next(); !option.empty(); option = lexer.next())
+  {
+    if (option.is("-M") || option.is("-P"))
+    {
+      bool isMaps = option.is("-M");
+      auto &values = isMaps ? command.maps : command.strategies;
+      (isMaps ? seenMaps : seenStrategies) = true;
+      while (!lexer.peek().empty() && !lexer.peek().isOption())
+      {
+        values.push_back(lexer.next().str());
+      }
+      if (values.empty())
+      {
+        return fail(command, lexer.position(), std::string("expected at least one ") + (isMaps ? "map" : "player strategy") + " after " + option.str());
+      }
+    }
+    else if (option.is("-G") || option.is("-D"))
+    {
+      bool isGames = option.is("-G");
+      CommandToken value = lexer.next();
+      if (!parseNumber(value, isGames ? command.games : command.turns))
+      {
+        return fail(command, value.empty() ? lexer.position() : value.position, "expected a number after " + option.str());
+      }
+      (isGames ? seenGames : seenTurns) = true;
+    }
+    else if (option.is("-O"))
+    {
+      CommandToken value = lexer.next();
+      if (value.empty() || value.isOption())
+      {
+        return fail(command, value.empty() ? lexer.position() : value.position, "expected a file after -O");
+      }
+      command.output = value.str();
+    }
+    else if (option.is("-F"))
+    {
+      CommandToken value = lexer.next();
+      if (!value.is("all") && !value.is("roundrobin") && !value.is("swiss"))
+      {
+        return fail(command, value.empty() ? lexer.position() : value.position, "expected all, roundrobin or swiss after -F");
+      }
+      command.format = value.str();
+    }
+    else
+    {
+      return fail(command, option.position, "unknown tournament option \"" + option.str() + "\"");
+    }
+  }
+
+  size_t end = lexer.position();
+  if (!seenMaps)
+  {
+    return fail(command, end, "missing -M <maps>");
+  }
+  if (!seenStrategies)
+  {
+    return fail(command, end, "missing -P <player strategies>");
+  }
+  if (!seenGames)
+  {
+    return fail(command, end, "missing -G <number of games>");
+  }
+  if (!seenTurns)
+  {
+    return fail(command, end, "missing -D <max number of turns>");
+  }
+  return command;
+}
+
+/**
+ * @brief Parses a command line into a typed command.
+ *
+ * @param input The raw command line.
+ * @return The typed command, carrying the error position if it is invalid.
+ */
+ParsedCommand CommandParser::parse(const std::string &input)
+{
+  ParsedCommand command;
+  CommandLexer lexer(input);
+  CommandToken word = lexer.next();
+
+  if (word.empty())
+  {
+    return fail(command, word.position, "empty command");
+  }
+
+  if (word.is("loadmap"))
+  {
+    command.type = CMD_LoadMap;
+    CommandToken path = lexer.rest();
+    if (path.length <= 4 || memcmp(path.begin + path.length - 4, ".map", 4) != 0)
+    {
+      return fail(command, path.empty() ? lexer.position() : path.position, "expected a .map file after loadmap");
+    }
+    command.path = path.str();
+    return command;
+  }
+  if (word.is("addplayer"))
+  {
+    command.type = CMD_AddPlayer;
+    CommandToken name = lexer.rest();
+    // player names never contain spaces
+    for (size_t i = 0; i < name.length; i++)
+    {
+      if (name.begin[i] != ' ')
+      {
+        command.name += name.begin[i];
+      }
+    }
+    if (command.name.empty())
+    {
+      return fail(command, lexer.position(), "expected a player name after addplayer");
+    }
+    return command;
+  }
+  if (word.is("tournament"))
+  {
+    command.type = CMD_Tournament;
+    return parseTournament(lexer, command);
+  }
+  if (word.is("replay"))
+  {
+    // "replay" alone restarts after a game, "replay <file>" plays back a recorded replay
+    command.type = CMD_Replay;
+    command.path = lexer.rest().str();
+    return command;
+  }
+
+  if (word.is("validatemap"))
+  {
+    command.type = CMD_ValidateMap;
+  }
+  else if (word.is("gamestart"))
+  {
+    command.type = CMD_GameStart;
+  }
+  else if (word.is("quit"))
+  {
+    command.type = CMD_Quit;
+  }
+  else
+  {
+    return fail(command, word.position, "unknown command \"" + word.str() + "\"");
+  }
+  return expectEnd(lexer, command);
+}
+
+/**
+ * @brief Checks whether the command was parsed successfully.
+ *
+ * @return True if the command is valid, false otherwise.
+ */
+bool ParsedCommand::isValid() const
+{
+  return type != CMD_Invalid && error.empty();
+}
+
+/**
+ * @brief Formats the error with its position.
+ *
+ * @return The formatted error message.
+ */
+std::string ParsedCommand::describeError() const
+{
+  return "column " + std::to_string(errorPosition + 1) + ": " + error;
+}
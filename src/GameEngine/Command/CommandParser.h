@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The kinds of commands understood by the command processor.
+ */
+enum CommandType
+{
+  CMD_Invalid,
+  CMD_LoadMap,
+  CMD_ValidateMap,
+  CMD_AddPlayer,
+  CMD_GameStart,
+  CMD_Replay,
+  CMD_Quit,
+  CMD_Tournament
+};
+
+/**
+ * @brief Typed result of parsing one command line.
+ *
+ * Only the fields belonging to the parsed command type are filled in.
+ * When parsing fails, error describes the problem and errorPosition is the 0-based column it was found at.
+ * The type is kept when the command word was recognised, and CMD_Invalid otherwise.
+ */
+struct ParsedCommand
+{
+  CommandType type = CMD_Invalid;
+
+  // loadmap <path> / replay [<replay file>] / addplayer <name>
+  std::string path;
+  std::string name;
+
+  // tournament -M <maps> -P <strategies> -G <games> -D <turns> [-O <csv file>] [-F all|roundrobin|swiss]
+  std::vector<std::string> maps;
+  std::vector<std::string> strategies;
+  int games = 0;
+  int turns = 0;
+  std::string output;
+  std::string format;
+
+  // Error reporting
+  std::string error;
+  size_t errorPosition = 0;
+
+  /**
+   * @brief Checks whether the command was parsed successfully.
+   *
+   * @return True if the command is valid, false otherwise.
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Formats the error with its position, e.g. "column 11: expected a number after -G".
+   *
+   * @return The formatted error message.
+   */
+  std::string describeError() const;
+};
+
+/**
+ * @brief Single-pass command lexer and parser.
+ *
+ * The lexer walks the input once and hands out tokens as pointer/length pairs into the input,
+ * so no intermediate strings are allocated while recognising a command.
+ */
+class CommandParser
+{
+public:
+  /**
+   * @brief Parses a command line.
+   *
+   * @param input The raw command line.
+   * @return The typed command, carrying the error position if it is invalid.
+   */
+  static ParsedCommand parse(const std::string &input);
+};
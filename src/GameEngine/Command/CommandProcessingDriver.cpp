@@ -1,5 +1,9 @@
 #include "CommandProcessingDriver.h"
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
 /**
  * @brief Function to test the command processor.
  * @param argc Number of command line arguments.
@@ -80,3 +84,59 @@ void testCommandProcessor(int argc, char *argv[])
     throw std::runtime_error("Invalid Command line arguments");
   }
 }
+
+/**
+ * @brief Benchmarks replaying a large command script through the FileLineReader.
+ */
+void benchmarkFileLineReader()
+{
+  const std::string scriptFile = "benchmark_commands.txt";
+  const int lines = 100000;
+
+  {
+    std::ofstream script(scriptFile);
+    for (int i = 0; i < lines; i++)
+    {
+      script << "addplayer player" << i << "\n";
+    }
+  }
+
+  FileLineReader flr;
+  flr.setFile(scriptFile);
+
+  int read = 0;
+  auto start = std::chrono::steady_clock::now();
+  while (!flr.getReadComplete())
+  {
+    flr.readLineFromFile();
+    read++;
+  }
+  auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  std::remove(scriptFile.c_str());
+
+  std::cout << "FileLineReader: read " << read << " lines in " << elapsed << " ms" << std::endl;
+}
+
+/**
+ * @brief Benchmarks parsing commands with the CommandParser.
+ */
+void benchmarkCommandParser()
+{
+  const std::vector<std::string> commands = {
+      "loadmap TestMap1_valid.map",
+      "validatemap",
+      "addplayer Bob",
+      "gamestart",
+      "tournament -M res/TestMap1_valid.map res/TestMap4_valid.map -P Aggressive Benevolent Cheater -G 3 -D 30"};
+  const int iterations = 200000;
+
+  int valid = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+  {
+    valid += CommandParser::parse(commands[i % commands.size()]).isValid();
+  }
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "CommandParser: " << elapsed / iterations << " ns per command (" << valid << " valid)" << std::endl;
+}
@@ -11,3 +11,13 @@
  * @param argv Array of command line arguments.
  */
 void testCommandProcessor(int argc, char** argv);
+
+/**
+ * @brief Benchmarks replaying a large command script through the FileLineReader.
+ */
+void benchmarkFileLineReader();
+
+/**
+ * @brief Benchmarks parsing commands with the CommandParser.
+ */
+void benchmarkCommandParser();
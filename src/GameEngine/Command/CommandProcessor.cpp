@@ -1,35 +1,10 @@
 #include "CommandProcessor.h"
 #include "../GameEngine.h"
+#include "../TournamentScheduler.h"
 #include <algorithm>
 
 using namespace std;
 
-regex regexRuleLoadMap("loadmap .+.map$");
-regex regexRulePlayerAdd("addplayer .+");
-
-/**
- * @brief Splits a string into a vector of strings based on a delimiter.
- * @param s The input string to be split.
- * @param delimiter The delimiter to split the string.
- * @return Vector of strings after splitting.
- */
-vector<string> split(string s, string delimiter)
-{
-  size_t pos_start = 0, pos_end, delim_len = delimiter.length();
-  string token;
-  vector<string> res;
-
-  while ((pos_end = s.find(delimiter, pos_start)) != string::npos)
-  {
-    token = s.substr(pos_start, pos_end - pos_start);
-    pos_start = pos_end + delim_len;
-    res.push_back(token);
-  }
-
-  res.push_back(s.substr(pos_start));
-  return res;
-}
-
 /**
  * @brief Constructor for CommandProcessor.
  * @param game Pointer to the GameEngine.
@@ -117,15 +92,39 @@ Command *CommandProcessor::validate(const string &_userInput)
 
   auto currentCommandObj = new Command(_userInput, game);
   GameEngineState current_game_state = game->getCurrentState();
-  std::string strCommand = currentCommandObj->getCommand();
+  ParsedCommand parsed = CommandParser::parse(_userInput);
+
+  if (!parsed.isValid() && parsed.type != CMD_Tournament)
+  {
+    cout << "Invalid Command (" << parsed.describeError() << ")" << endl;
+    currentCommandObj->saveEffect("Invalid Command");
+    return currentCommandObj;
+  }
+
+  // Playing back a replay file leaves the game untouched, so it is allowed between games
+  if (parsed.type == CMD_Replay && !parsed.path.empty() && (current_game_state == GE_Start || current_game_state == GE_Win))
+  {
+    try
+    {
+      cout << ReplayPlayer::report(parsed.path) << endl;
+    }
+    catch (std::runtime_error &err)
+    {
+      cout << err.what() << endl;
+      currentCommandObj->saveEffect("Invalid Command");
+      return currentCommandObj;
+    }
+    currentCommandObj->saveEffect("Replay " + parsed.path + " played back");
+    cout << currentCommandObj->getEffect() << endl;
+    return currentCommandObj;
+  }
 
   switch (current_game_state)
   {
   case GE_Start:
-    if (std::regex_match(_userInput, regexRuleLoadMap))
+    if (parsed.type == CMD_LoadMap)
     {
-      size_t pos = strCommand.find(' ');
-      std::string mapName = "res/" + MapLoader::trim(strCommand.substr(pos));
+      std::string mapName = "res/" + parsed.path;
       try
       {
         game->loadMap(mapName);
@@ -141,11 +140,11 @@ Command *CommandProcessor::validate(const string &_userInput)
       return currentCommandObj;
     }
 
-    else if (_userInput.substr(0, _userInput.find(' ')) == "tournament")
+    else if (parsed.type == CMD_Tournament)
     {
-      TournamentFunctionInput(_userInput);
       try
       {
+        TournamentFunctionInput(parsed);
         game->validateTournament();
       }
       catch (std::runtime_error &err)
@@ -163,7 +162,7 @@ Command *CommandProcessor::validate(const string &_userInput)
     break;
 
   case GE_Map_Loaded:
-    if (_userInput == "validatemap")
+    if (parsed.type == CMD_ValidateMap)
     {
 
       try
@@ -182,22 +181,16 @@ Command *CommandProcessor::validate(const string &_userInput)
       cout << currentCommandObj->getEffect() << endl;
       return currentCommandObj;
     }
-    else if (std::regex_match(_userInput, regexRuleLoadMap))
+    else if (parsed.type == CMD_LoadMap)
     {
       cout << "Map already loaded" << endl;
     }
     break;
 
   case GE_Map_Validated:
-    if (std::regex_match(_userInput, regexRulePlayerAdd))
+    if (parsed.type == CMD_AddPlayer)
     {
-
-      size_t pos = strCommand.find(' ');
-      std::string playerName = strCommand.substr(pos);
-
-      // trim spacing
-      std::string::iterator end_pos = std::remove(playerName.begin(), playerName.end(), ' ');
-      playerName.erase(end_pos, playerName.end());
+      const std::string &playerName = parsed.name;
 
       if (game->isTesting())
       {
@@ -216,7 +209,7 @@ Command *CommandProcessor::validate(const string &_userInput)
     break;
 
   case GE_Players_Added:
-    if (std::regex_match(_userInput, regexRulePlayerAdd))
+    if (parsed.type == CMD_AddPlayer)
     {
 
       try
@@ -229,12 +222,7 @@ Command *CommandProcessor::validate(const string &_userInput)
         break;
       }
 
-      size_t pos = strCommand.find(' ');
-      std::string playerName = strCommand.substr(pos);
-
-      // trim spacing
-      std::string::iterator end_pos = std::remove(playerName.begin(), playerName.end(), ' ');
-      playerName.erase(end_pos, playerName.end());
+      const std::string &playerName = parsed.name;
 
       if (game->isTesting())
       {
@@ -250,39 +238,12 @@ Command *CommandProcessor::validate(const string &_userInput)
       cout << currentCommandObj->getEffect() << endl;
       return currentCommandObj;
     }
-    else if (_userInput == "gamestart")
+    else if (parsed.type == CMD_GameStart)
     {
 
-      // Check for minimum 2 players before starting
-      try
-      {
-        game->validateMinPlayers();
-      }
-      catch (std::runtime_error &err)
-      {
-        cout << err.what() << endl;
-        break;
-      }
-
-      game->distributeTerritories();
-      cout << "Territories distributed." << endl;
-
-      game->playerOrder();
-      cout << "Order of play of players determined." << endl;
-
-      // initialize deck
-      game->getDeck()->create_deck();
-
       try
       {
-        for (Player *player : *game->getPlayers())
-        {
-          player->setReinforcementPool(50);
-          game->setCurrentPlayer(player);
-          Hand &hand = *player->getHand();
-          game->getDeck()->draw(hand);
-          game->getDeck()->draw(hand);
-        }
+        game->startGame();
       }
       catch (std::runtime_error &err)
       {
@@ -290,7 +251,6 @@ Command *CommandProcessor::validate(const string &_userInput)
         break;
       }
 
-      game->setCurrentState(GE_Reinforcement);
       currentCommandObj->saveEffect("Game successfully started");
       cout << currentCommandObj->getEffect() << endl;
       game->mainGameLoop();
@@ -299,7 +259,7 @@ Command *CommandProcessor::validate(const string &_userInput)
     break;
 
   case GE_Win:
-    if (_userInput == "replay")
+    if (parsed.type == CMD_Replay)
     {
       game->setCurrentState(GE_Start);
       currentCommandObj->saveEffect("Game successfully restarted");
@@ -307,7 +267,7 @@ Command *CommandProcessor::validate(const string &_userInput)
            << endl;
       return currentCommandObj;
     }
-    else if (_userInput == "quit")
+    else if (parsed.type == CMD_Quit)
     {
       cout << "Quitting game";
       exit(0);
@@ -441,97 +401,66 @@ CommandProcessor::~CommandProcessor()
 }
 
 /**
- * @brief Processes the input string for the tournament command.
+ * @brief Parses the input string for the tournament command and applies it to the game.
  * @param input Input string containing tournament command and parameters.
+ * @throws std::runtime_error if the input is not a valid tournament command.
  */
 void CommandProcessor::TournamentFunctionInput(string input)
 {
-  vector<string> enteredTournamentString = split(input, " ");
-  int i = 1; // skip the first word "tournament"
-  while (i < enteredTournamentString.size())
-  {
-    if (enteredTournamentString[i] == "-M")
-    {
-      while (enteredTournamentString[++i] != "-P")
-      {
-        game->allMaps.push_back(enteredTournamentString[i]);
-      }
-    }
-    else if (enteredTournamentString[i] == "-P")
-    {
-      while (enteredTournamentString[++i] != "-G")
-      {
-        game->allPlayerStrategies.push_back(enteredTournamentString[i]);
-      }
-    }
-    else if (enteredTournamentString[i] == "-G")
-    {
-      i++;
-      string temp;
-      temp = enteredTournamentString[i++];
-      if (!isdigit(temp[0]))
-      {
-        cout << "The number of games has to be a digit" << endl;
-        exit(0);
-      }
-      game->numberOfGames = stoi(temp);
-    }
-    else if (enteredTournamentString[i] == "-D")
-    {
-      i++;
-      string temp;
-      temp = enteredTournamentString[i++];
-      if (!isdigit(temp[0]))
-      {
-        cout << "The max number of turns has to be a digit" << endl;
-        exit(0);
-      }
-      game->maxNumberOfTurns = stoi(temp);
-    }
-  }
+  TournamentFunctionInput(CommandParser::parse(input));
 }
 
 /**
- * @brief Processes the input string for the tournament command from a file.
- * @param input Input file containing tournament commands and parameters.
+ * @brief Applies a parsed tournament command to the game.
+ * @param command The parsed tournament command.
+ * @throws std::runtime_error if the command is not a valid tournament command.
  */
-void CommandProcessor::FileTournamentFunctionInput(string input)
+void CommandProcessor::TournamentFunctionInput(const ParsedCommand &command)
 {
-
-  std::ifstream temp(input);
-  int numberOfTournaments = 0;
-  int tournamentsPlayed = 0;
-  std::string lineCounter;
-  while (std::getline(temp, lineCounter))
+  if (command.type != CMD_Tournament)
   {
-    numberOfTournaments++;
+    throw std::runtime_error("CommandProcessor::Error | Not a tournament command");
   }
-
-  if (numberOfTournaments > 1)
+  if (!command.isValid())
   {
-    game->multipleTournaments = true;
+    throw std::runtime_error("CommandProcessor::Error | Invalid tournament command, " + command.describeError());
   }
+  game->configureTournament(command);
+}
 
-  temp.close();
-  ifstream ifs;
-  string line;
-  ifs.open(input);
-
-  if (!ifs.is_open())
-  {
-    throw std::runtime_error("File already open");
-  }
-  while (getline(ifs, line))
+/**
+ * @brief Runs every tournament listed in a file, concurrently, each on its own game engine.
+ * The results table of line N is written to "<file without extension>_results.N.txt". Tournaments whose table is
+ * already there from an earlier run are skipped, so an interrupted file can simply be run again.
+ * @param input Input file containing one tournament command per line.
+ * @throws std::runtime_error if the file cannot be read or contains an invalid tournament command.
+ */
+void CommandProcessor::FileTournamentFunctionInput(string input)
+{
+  // The tournament engines are independent of this game, so they need no command line arguments.
+  TournamentScheduler scheduler(0, nullptr);
+  scheduler.setLimits(game->tournamentLimits);
+  size_t extension = input.find_last_of('.');
+  size_t directory = input.find_last_of("/\\");
+  std::string base = (extension != string::npos && (directory == string::npos || extension > directory)) ? input.substr(0, extension) : input;
+  scheduler.loadJobs(input, base + "_results");
+
+  std::vector<TournamentJobResult> results = scheduler.run();
+  const std::vector<TournamentJob> &jobs = scheduler.getJobs();
+  for (size_t i = 0; i < jobs.size(); i++)
   {
-    TournamentFunctionInput(line);
-    game->validateTournament();
-    game->runTournament();
-    tournamentsPlayed++;
-    std::cout << std::endl;
-    if (tournamentsPlayed < numberOfTournaments)
+    cout << "Tournament on line " << jobs[i].line << ": ";
+    if (results[i].skipped)
+    {
+      cout << "already done, results in " << jobs[i].outputFile << endl;
+    }
+    else if (results[i].succeeded)
+    {
+      cout << "results written to " << jobs[i].outputFile << endl;
+    }
+    else
     {
-      std::cout << "------- NEXT TOURNAMENT STARTING NOW! -------" << std::endl;
+      cout << "failed, " << results[i].error << endl;
     }
   }
-  ifs.close();
-}
\ No newline at end of file
+}
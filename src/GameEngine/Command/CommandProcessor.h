@@ -3,8 +3,8 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
-#include <regex>
 #include "Logger/LogObserver.h"
+#include "CommandParser.h"
 
 class Command;
 
@@ -46,9 +46,10 @@ private:
 
 public:
   /**
-   * @brief Processes input for a file-based tournament.
+   * @brief Runs every tournament of a file concurrently, each writing its results table to its own file.
    *
-   * @param input The input for the file-based tournament.
+   * @param input The file listing one tournament command per line.
+   * @throws std::runtime_error if the file cannot be read or contains an invalid tournament command.
    */
   void FileTournamentFunctionInput(std::string input);
 
@@ -56,9 +57,17 @@ public:
    * @brief Processes input for a tournament.
    *
    * @param input The input for the tournament.
+   * @throws std::runtime_error if the input is not a valid tournament command.
    */
   void TournamentFunctionInput(std::string);
 
+  /**
+   * @brief Applies an already parsed tournament command to the game.
+   *
+   * @param command The parsed tournament command.
+   */
+  void TournamentFunctionInput(const ParsedCommand &command);
+
   // Constructors
   /**
    * @brief Constructor for CommandProcessor.
@@ -0,0 +1,309 @@
+#include "CommandScript.h"
+#include "../GameEngine.h"
+#include "../QuietConsole.h"
+
+/**
+ * @brief Gets the command word of a command type.
+ *
+ * @param type The command type.
+ * @return The word used to type the command.
+ */
+static std::string commandWord(CommandType type)
+{
+  switch (type)
+  {
+  case CMD_LoadMap:
+    return "loadmap";
+  case CMD_ValidateMap:
+    return "validatemap";
+  case CMD_AddPlayer:
+    return "addplayer";
+  case CMD_GameStart:
+    return "gamestart";
+  case CMD_Replay:
+    return "replay";
+  case CMD_Quit:
+    return "quit";
+  case CMD_Tournament:
+    return "tournament";
+  case CMD_Invalid:
+    break;
+  }
+  return "invalid command";
+}
+
+/**
+ * @brief Prefixes a message with the script line it refers to.
+ *
+ * @param line The 1-based line number.
+ * @param message The message.
+ * @return The formatted message.
+ */
+static std::string atLine(int line, const std::string &message)
+{
+  return "line " + std::to_string(line) + ": " + message;
+}
+
+/**
+ * @brief Plans a script given as separate lines.
+ * Blank lines and lines starting with '#' are skipped.
+ * @param lines The lines of the script, the first one being line 1.
+ * @return The planned script.
+ */
+CommandScript CommandScript::fromLines(const std::vector<std::string> &lines)
+{
+  CommandScript script;
+  for (size_t i = 0; i < lines.size(); i++)
+  {
+    size_t first = lines[i].find_first_not_of(" \t\r");
+    if (first == std::string::npos || lines[i][first] == '#')
+    {
+      continue;
+    }
+    ScriptStep step;
+    step.line = (int)i + 1;
+    step.command = CommandParser::parse(lines[i]);
+    script.steps.push_back(step);
+  }
+  script.plan();
+  return script;
+}
+
+/**
+ * @brief Reads and plans a command file.
+ * @param fileName The script to read.
+ * @return The planned script.
+ * @throws std::runtime_error if the file cannot be read.
+ */
+CommandScript CommandScript::fromFile(const std::string &fileName)
+{
+  FileLineReader reader;
+  reader.setFile(fileName);
+  std::vector<std::string> lines;
+  while (!reader.getReadComplete())
+  {
+    lines.push_back(reader.readLineFromFile());
+  }
+  return fromLines(lines);
+}
+
+/**
+ * @brief Replays the steps against the startup state transitions without touching a game.
+ * A step that fails leaves the simulated state unchanged, like an invalid command typed in the console,
+ * so the following steps are still checked.
+ */
+void CommandScript::plan()
+{
+  errors.clear();
+  GameEngineState state = GE_Start;
+  int players = 0;
+
+  for (const ScriptStep &step : steps)
+  {
+    const ParsedCommand &command = step.command;
+    if (!command.isValid())
+    {
+      errors.push_back("line " + std::to_string(step.line) + ", " + command.describeError());
+      continue;
+    }
+
+    GameEngineState required = GE_Start;
+    switch (command.type)
+    {
+    case CMD_LoadMap:
+    case CMD_Tournament:
+      required = GE_Start;
+      break;
+    case CMD_ValidateMap:
+      required = GE_Map_Loaded;
+      break;
+    case CMD_AddPlayer:
+      required = state == GE_Players_Added ? GE_Players_Added : GE_Map_Validated;
+      break;
+    case CMD_GameStart:
+      required = GE_Players_Added;
+      break;
+    case CMD_Replay:
+      // Playing back a replay file is allowed between games and leaves the state as it is
+      required = command.path.empty() || state != GE_Start ? GE_Win : GE_Start;
+      break;
+    case CMD_Quit:
+      required = state;
+      break;
+    case CMD_Invalid:
+      break;
+    }
+
+    if (state != required)
+    {
+      errors.push_back(atLine(step.line, commandWord(command.type) + " is not allowed in state " + GameEngine::stateToString(state)));
+      continue;
+    }
+
+    switch (command.type)
+    {
+    case CMD_LoadMap:
+      state = GE_Map_Loaded;
+      break;
+    case CMD_ValidateMap:
+      state = GE_Map_Validated;
+      break;
+    case CMD_AddPlayer:
+      if (players == 6)
+      {
+        errors.push_back(atLine(step.line, "maximum number of players(6) reached"));
+        continue;
+      }
+      players++;
+      state = GE_Players_Added;
+      break;
+    case CMD_GameStart:
+      if (players < 2)
+      {
+        errors.push_back(atLine(step.line, "gamestart needs at least two(2) players"));
+        continue;
+      }
+      state = GE_Win;
+      break;
+    case CMD_Replay:
+      if (command.path.empty())
+      {
+        players = 0;
+        state = GE_Start;
+      }
+      break;
+    case CMD_Quit:
+    case CMD_Tournament:
+    case CMD_Invalid:
+      break;
+    }
+
+    if (command.type == CMD_Quit && &step != &steps.back())
+    {
+      errors.push_back(atLine((&step + 1)->line, "commands after quit are never run"));
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Checks whether the script can run.
+ * @return True if no error was found while planning, false otherwise.
+ */
+bool CommandScript::isValid() const
+{
+  return errors.empty();
+}
+
+/**
+ * @brief Gets the commands of the script, in order.
+ * @return The planned steps.
+ */
+const std::vector<ScriptStep> &CommandScript::getSteps() const
+{
+  return steps;
+}
+
+/**
+ * @brief Gets every error found while planning.
+ * @return The errors, in line order.
+ */
+const std::vector<std::string> &CommandScript::getErrors() const
+{
+  return errors;
+}
+
+/**
+ * @brief Runs the plan straight on the game engine, with the console silenced.
+ * Each game is reported on its own line once it is over. A tournament is reported with its results table
+ * and leaves the game back in the start state, so a script can chain several of them.
+ * @param game The game engine to drive, in the start state.
+ * @param report Stream receiving the results.
+ * @param mapDirectory Directory prepended to the map names of loadmap.
+ * @return The number of games played.
+ * @throws std::runtime_error if the plan is invalid or a step fails at run time.
+ */
+int CommandScript::execute(GameEngine *game, std::ostream &report, const std::string &mapDirectory) const
+{
+  if (!isValid())
+  {
+    throw std::runtime_error("CommandScript::Error | The script has " + std::to_string(errors.size()) + " error(s)");
+  }
+  if (game->getCurrentState() != GE_Start)
+  {
+    throw std::runtime_error("CommandScript::Error | The game must be in the Start state to run a script");
+  }
+
+  int gamesPlayed = 0;
+  std::string mapName;
+
+  for (const ScriptStep &step : steps)
+  {
+    const ParsedCommand &command = step.command;
+    std::string result;
+    try
+    {
+      QuietConsole quiet;
+      switch (command.type)
+      {
+      case CMD_LoadMap:
+        mapName = command.path;
+        game->loadMap(mapDirectory + mapName);
+        game->setCurrentState(GE_Map_Loaded);
+        break;
+      case CMD_ValidateMap:
+        if (!game->validateMap())
+        {
+          throw std::runtime_error("map " + mapName + " is invalid");
+        }
+        game->setCurrentState(GE_Map_Validated);
+        break;
+      case CMD_AddPlayer:
+        new Player(game, new Hand(), command.name, "Random");
+        game->setCurrentState(GE_Players_Added);
+        break;
+      case CMD_GameStart:
+      {
+        game->startGame();
+        game->mainGameLoop();
+        gamesPlayed++;
+        Player *winner = game->getWinningPlayer();
+        result = "Game " + std::to_string(gamesPlayed) + " on " + mapName + ": " + (winner ? winner->getName() + " wins" : "draw");
+        break;
+      }
+      case CMD_Replay:
+        if (!command.path.empty())
+        {
+          result = ReplayPlayer::report(command.path);
+          break;
+        }
+        game->resetGame();
+        game->setCurrentState(GE_Start);
+        break;
+      case CMD_Tournament:
+        game->configureTournament(command);
+        game->validateTournament();
+        game->setCurrentState(GE_Tournament);
+        gamesPlayed += game->runTournament();
+        result = game->getTournamentResults();
+        game->resetGame();
+        game->setCurrentState(GE_Start);
+        break;
+      case CMD_Quit:
+        return gamesPlayed;
+      case CMD_Invalid:
+        break;
+      }
+    }
+    catch (std::runtime_error &err)
+    {
+      throw std::runtime_error(atLine(step.line, err.what()));
+    }
+
+    if (!result.empty())
+    {
+      report << result << std::endl;
+    }
+  }
+  return gamesPlayed;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "CommandParser.h"
+
+class GameEngine;
+
+/**
+ * @brief One command of a script, with the line it came from.
+ */
+struct ScriptStep
+{
+  int line = 0;
+  ParsedCommand command;
+};
+
+/**
+ * @brief A whole command file parsed and checked up front, then run without going through the command processor.
+ *
+ * Every line is parsed and replayed against the startup state transitions before anything runs, so all
+ * syntax errors, out of order commands and player count problems are reported together. A valid plan is then
+ * executed straight on the game engine: commands are not logged, saved or echoed and the game output is
+ * silenced, leaving one result line per game. Blank lines and lines starting with '#' are ignored.
+ * Players are always added with the "Random" strategy since nobody is there to play a human turn.
+ */
+class CommandScript
+{
+private:
+  std::vector<ScriptStep> steps;
+  std::vector<std::string> errors;
+
+  /**
+   * @brief Checks the steps against the game state transitions and records every error found.
+   */
+  void plan();
+
+public:
+  /**
+   * @brief Reads and plans a command file.
+   *
+   * @param fileName The script to read.
+   * @return The planned script.
+   * @throws std::runtime_error if the file cannot be read.
+   */
+  static CommandScript fromFile(const std::string &fileName);
+
+  /**
+   * @brief Plans a script given as separate lines.
+   *
+   * @param lines The lines of the script, the first one being line 1.
+   * @return The planned script.
+   */
+  static CommandScript fromLines(const std::vector<std::string> &lines);
+
+  /**
+   * @brief Checks whether the script can run.
+   *
+   * @return True if no error was found while planning, false otherwise.
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Gets the commands of the script, in order.
+   *
+   * @return The planned steps.
+   */
+  const std::vector<ScriptStep> &getSteps() const;
+
+  /**
+   * @brief Gets every error found while planning, e.g. "line 3, column 12: expected a number after -G".
+   *
+   * @return The errors, in line order.
+   */
+  const std::vector<std::string> &getErrors() const;
+
+  /**
+   * @brief Runs the plan on a game engine that is in the start state.
+   *
+   * @param game The game engine to drive.
+   * @param report Stream receiving one line per finished game or tournament.
+   * @param mapDirectory Directory prepended to the map names of loadmap, ending with '/'.
+   * @return The number of games played.
+   * @throws std::runtime_error if the plan is invalid, or a step fails at run time (e.g. a missing or invalid map).
+   */
+  int execute(GameEngine *game, std::ostream &report, const std::string &mapDirectory = "res/") const;
+};
@@ -9,27 +9,45 @@ FileLineReader::FileLineReader(const FileLineReader &flr)
 {
   fileName = flr.fileName;
   readComplete = flr.readComplete;
+  currentLine = flr.currentLine;
 }
 
 /**
- * @brief Reads a line from the file and updates the current line pointer.
+ * @brief Opens the file on first use and positions the stream at the current line.
+ * The stream then stays open, so each following read only consumes the next line.
+ */
+void FileLineReader::openIfNeeded()
+{
+  if (fileInputStream.is_open())
+  {
+    return;
+  }
+  fileInputStream.clear();
+  fileInputStream.open(fileName);
+  if (fileInputStream.is_open() && currentLine > 1)
+  {
+    GotoLine(fileInputStream, getCurrentLine());
+  }
+}
+
+/**
+ * @brief Reads the next line from the file and updates the current line pointer.
+ * End of file is detected by peeking after the read, so the file is never scanned ahead.
  * @return A string containing the read line.
- * @throws std::runtime_error if the file cannot be opened.
+ * @throws std::runtime_error if the file cannot be opened or was already read completely.
  */
 std::string FileLineReader::readLineFromFile()
 {
-
-  std::ifstream fileInputStream(fileName);
-  int maxLines = maxNumberOfLines(fileName);
+  openIfNeeded();
   std::string line;
 
   if (fileInputStream.is_open() && !readComplete)
   {
-    GotoLine(fileInputStream, getCurrentLine());
     getline(fileInputStream, line);
-    if (getCurrentLine() == maxLines)
+    if (fileInputStream.peek() == std::ifstream::traits_type::eof())
     {
       this->readComplete = true;
+      fileInputStream.close();
     }
     incrementCurrentLine();
     return line;
@@ -82,6 +100,9 @@ int FileLineReader::maxNumberOfLines(const std::string &_fileName)
 void FileLineReader::setFile(std::string _fileName)
 {
   fileName = std::move(_fileName);
+  fileInputStream.close();
+  readComplete = false;
+  currentLine = 1;
 }
 
 /**
@@ -137,6 +158,8 @@ FileLineReader &FileLineReader::operator=(const FileLineReader &other)
 
   this->fileName = other.fileName;
   this->readComplete = other.readComplete;
+  this->currentLine = other.currentLine;
+  this->fileInputStream.close();
 
   return *this;
 }
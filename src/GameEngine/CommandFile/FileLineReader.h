@@ -11,6 +11,12 @@ private:
     std::string fileName;      /**< The name of the file being read. */
     bool readComplete = false; /**< Flag indicating whether the file reading is complete. */
     int currentLine = 1;       /**< The current line being read in the file. */
+    std::ifstream fileInputStream; /**< Stream kept open between reads, positioned at currentLine. */
+
+    /**
+     * @brief Open the file and position the stream at the current line, if it is not open yet.
+     */
+    void openIfNeeded();
 
 public:
     /**
@@ -50,7 +56,7 @@ public:
     int maxNumberOfLines(const std::string &_fileName);
 
     /**
-     * @brief Set the file to be read.
+     * @brief Set the file to be read. Reading restarts from the first line.
      *
      * @param _fileName The name of the file to be set.
      */
@@ -0,0 +1,119 @@
+#include "DiplomacyTable.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+const int DiplomacyTable::MAX_PLAYERS;
+
+/**
+ * @brief Sets the number of player IDs, keeping the relations of existing players.
+ * @param players The number of player IDs.
+ * @throws std::runtime_error if there are more than MAX_PLAYERS player IDs.
+ */
+void DiplomacyTable::resize(int players)
+{
+  if (players > MAX_PLAYERS)
+  {
+    throw std::runtime_error("DiplomacyTable::Error | At most " + std::to_string(MAX_PLAYERS) + " players are supported");
+  }
+  peace.resize(players, 0);
+  // Players dropped by a shrink must not stay at peace with the others
+  uint64_t kept = players == 64 ? ~0ULL : (1ULL << players) - 1;
+  for (auto &row : peace)
+  {
+    row &= kept;
+  }
+}
+
+/**
+ * @brief Gets the number of player IDs.
+ * @return The number of player IDs.
+ */
+int DiplomacyTable::size() const
+{
+  return (int)peace.size();
+}
+
+/**
+ * @brief Records that two players negotiated.
+ * @param first The ID of one player.
+ * @param second The ID of the other player.
+ */
+void DiplomacyTable::makePeace(int first, int second)
+{
+  peace.at(first) |= 1ULL << second;
+  peace.at(second) |= 1ULL << first;
+}
+
+/**
+ * @brief Ends every negotiation of one player.
+ * @param player The ID of the player.
+ */
+void DiplomacyTable::clearPlayer(int player)
+{
+  peace.at(player) = 0;
+  for (auto &row : peace)
+  {
+    row &= ~(1ULL << player);
+  }
+}
+
+/**
+ * @brief Ends every negotiation.
+ */
+void DiplomacyTable::reset()
+{
+  std::fill(peace.begin(), peace.end(), 0);
+}
+
+/**
+ * @brief Checks whether two players negotiated.
+ * @param first The ID of one player.
+ * @param second The ID of the other player.
+ * @return True if the players are at peace, false otherwise.
+ */
+bool DiplomacyTable::atPeace(int first, int second) const
+{
+  if (first < 0 || first >= size() || second < 0)
+  {
+    return false;
+  }
+  return (peace[first] >> second) & 1;
+}
+
+/**
+ * @brief Gets the players a player negotiated with.
+ * @param player The ID of the player.
+ * @return Bit p set for every player ID p at peace with the player.
+ */
+uint64_t DiplomacyTable::peaceMask(int player) const
+{
+  return player >= 0 && player < size() ? peace[player] : 0;
+}
+
+/**
+ * @brief Checks whether a player may attack a territory owner.
+ * @param attacker The ID of the attacking player.
+ * @param defender The ID of the owner, or -1 for neutral.
+ * @return False for the player itself and players it negotiated with, true otherwise.
+ */
+bool DiplomacyTable::canAttack(int attacker, int defender) const
+{
+  return attacker != defender && !atPeace(attacker, defender);
+}
+
+/**
+ * @brief Gets the owners a player may attack.
+ * @param attacker The ID of the attacking player.
+ * @return Bit (ownerId + 1) set for every attackable owner, bit 0 for neutral.
+ */
+uint64_t DiplomacyTable::attackableMask(int attacker) const
+{
+  uint64_t friends = peaceMask(attacker);
+  if (attacker >= 0)
+  {
+    friends |= 1ULL << attacker;
+  }
+  return ~(friends << 1);
+}
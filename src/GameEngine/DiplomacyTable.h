@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Which players negotiated with each other this round, as a players x players bit matrix.
+ *
+ * Each player ID has one 64-bit row holding a bit per player it is at peace with, so canAttack is a shift and a
+ * mask, and the end-of-round reset clears the whole table at once.
+ *
+ * attackableMask packs the owners a player may attack into 64 bits, with bit (ownerId + 1) for each owner and bit 0
+ * for neutral territories. Testing a territory's owner against it needs no branch for neutral owners:
+ * isAttackable(mask, store->owner[id]).
+ */
+class DiplomacyTable
+{
+private:
+  std::vector<uint64_t> peace;
+
+public:
+  // Largest number of player IDs: one bit per owner in attackable masks, plus neutral
+  static const int MAX_PLAYERS = 63;
+
+  /**
+   * @brief Sets the number of player IDs, keeping the relations of existing players.
+   *
+   * @param players The number of player IDs.
+   * @throws std::runtime_error if there are more than MAX_PLAYERS player IDs.
+   */
+  void resize(int players);
+
+  /**
+   * @brief Gets the number of player IDs.
+   *
+   * @return The number of player IDs.
+   */
+  int size() const;
+
+  /**
+   * @brief Records that two players negotiated: neither can attack the other until the table is reset.
+   *
+   * @param first The ID of one player.
+   * @param second The ID of the other player.
+   */
+  void makePeace(int first, int second);
+
+  /**
+   * @brief Ends every negotiation of one player.
+   *
+   * @param player The ID of the player.
+   */
+  void clearPlayer(int player);
+
+  /**
+   * @brief Ends every negotiation, at the end of a round.
+   */
+  void reset();
+
+  /**
+   * @brief Gets the players a player negotiated with.
+   *
+   * @param player The ID of the player.
+   * @return Bit p set for every player ID p at peace with the player.
+   */
+  uint64_t peaceMask(int player) const;
+
+  /**
+   * @brief Checks whether two players negotiated.
+   *
+   * @param first The ID of one player.
+   * @param second The ID of the other player.
+   * @return True if the players are at peace, false otherwise.
+   */
+  bool atPeace(int first, int second) const;
+
+  /**
+   * @brief Checks whether a player may attack a territory owner.
+   *
+   * @param attacker The ID of the attacking player.
+   * @param defender The ID of the owner, or -1 for neutral.
+   * @return False for the player itself and players it negotiated with, true otherwise.
+   */
+  bool canAttack(int attacker, int defender) const;
+
+  /**
+   * @brief Gets the owners a player may attack.
+   *
+   * @param attacker The ID of the attacking player.
+   * @return Bit (ownerId + 1) set for every attackable owner, bit 0 for neutral.
+   */
+  uint64_t attackableMask(int attacker) const;
+
+  /**
+   * @brief Tests an owner against an attackable mask.
+   *
+   * @param mask The mask from attackableMask.
+   * @param ownerId The ID of the owner, or -1 for neutral.
+   * @return True if the owner can be attacked.
+   */
+  static bool isAttackable(uint64_t mask, int32_t ownerId)
+  {
+    return (mask >> (uint32_t)(ownerId + 1)) & 1;
+  }
+};
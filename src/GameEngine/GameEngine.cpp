@@ -1,7 +1,10 @@
 #include "GameEngine.h"
+#include "BinaryCodec.h"
 #include "Player/PlayerStrategies.h"
 #include <random>
 #include <iomanip>
+#include <climits>
+#include <fstream>
 
 /**
  * @brief Sets the current state of the game engine.
@@ -22,6 +25,22 @@ GameEngineState GameEngine::getCurrentState()
   return this->state;
 }
 
+/**
+ * @brief Gets the Zobrist hash of the game position: territory owners, bucketed army counts and the current phase.
+ * It is maintained incrementally by the map's territory store, so this is O(1).
+ * @return The hash of the current position.
+ * @throws std::runtime_error if no map is loaded.
+ */
+uint64_t GameEngine::getStateHash()
+{
+  if (map == nullptr)
+  {
+    throw std::runtime_error("GameEngine::getStateHash::Assert Map is null.");
+  }
+  // Territory keys never use 0xFFFFFFFF as territory ID, so phase keys cannot collide with them
+  return map->getStore()->hash() ^ TerritoryStore::mixKey(0xFFFFFFFF00000000ULL | (uint32_t)state);
+}
+
 /**
  * @brief Constructor for the GameEngine class.
  * @param state Initial state of the game engine.
@@ -32,6 +51,7 @@ GameEngineState GameEngine::getCurrentState()
 GameEngine::GameEngine(GameEngineState state, int argc, char **argv, bool testing)
 {
   this->state = state;
+  setSeed(std::random_device()());
   this->deck = new Deck(this);
   this->map = new Map(this);
   this->logObserver = new LogObserver(this);
@@ -113,6 +133,36 @@ void GameEngine::validateMinPlayers()
   }
 }
 
+/**
+ * @brief Sets up a game with the players already added.
+ * Distributes the territories, determines the order of play, builds the deck and gives every player
+ * 50 reinforcements and two cards. The game is left in the reinforcement state, ready for mainGameLoop().
+ * @throws std::runtime_error if fewer than two players were added or the deck runs out of cards.
+ */
+void GameEngine::startGame()
+{
+  validateMinPlayers();
+
+  distributeTerritories();
+  cout << "Territories distributed." << endl;
+
+  playerOrder();
+  cout << "Order of play of players determined." << endl;
+
+  deck->create_deck();
+
+  for (Player *player : players)
+  {
+    player->setReinforcementPool(50);
+    setCurrentPlayer(player);
+    Hand &hand = *player->getHand();
+    deck->draw(hand);
+    deck->draw(hand);
+  }
+
+  setCurrentState(GE_Reinforcement);
+}
+
 /**
  * @brief Distributes territories among the players.
  * Territories are distributed based on the number of players and the total number of territories.
@@ -189,11 +239,21 @@ void GameEngine::printCommands()
 /**
  * @brief Converts the current game state to a string representation.
  * @return String representation of the current game state.
- * @throws std::runtime_error if the state is invalid.
  */
 std::string GameEngine::getCurrentStateToString()
 {
-  switch (this->state)
+  return stateToString(state);
+}
+
+/**
+ * @brief Converts a game state to its display name.
+ * @param engineState The state to convert.
+ * @return String representation of the state.
+ * @throws std::runtime_error if the state is invalid.
+ */
+std::string GameEngine::stateToString(GameEngineState engineState)
+{
+  switch (engineState)
   {
   case GE_Start:
     return "Start";
@@ -245,6 +305,34 @@ Deck *GameEngine::getDeck()
   return this->deck;
 }
 
+/**
+ * @brief Restarts the game's random number generator from a seed.
+ * @param newSeed The seed.
+ */
+void GameEngine::setSeed(uint32_t newSeed)
+{
+  seed = newSeed;
+  rng.seed(newSeed);
+}
+
+/**
+ * @brief Gets the seed the game's random number generator started from.
+ * @return The seed.
+ */
+uint32_t GameEngine::getSeed() const
+{
+  return seed;
+}
+
+/**
+ * @brief Gets the game's random number generator.
+ * @return The generator.
+ */
+std::mt19937 &GameEngine::getRng()
+{
+  return rng;
+}
+
 /**
  * @brief Gets the map associated with the game engine.
  * @return Pointer to the map.
@@ -287,7 +375,74 @@ void GameEngine::addPlayer(Player *player)
   {
     throw std::runtime_error("GameEngine::ASSERT | Cannot add player to game. Game is already in progress.");
   }
+  player->setId((int)this->playersById.size());
+  this->playersById.push_back(player);
   this->players.push_back(player);
+  this->diplomacy.resize((int)this->playersById.size());
+}
+
+/**
+ * @brief Updates the ownership counts when a territory changes hands.
+ * A player dropping to zero territories is queued for elimination, a player reaching every territory becomes the winner.
+ * @param oldOwnerId The ID of the previous owner, or -1 if neutral.
+ * @param newOwnerId The ID of the new owner, or -1 if neutral.
+ */
+void GameEngine::onTerritoryOwnerChanged(int oldOwnerId, int newOwnerId)
+{
+  int largestId = std::max(oldOwnerId, newOwnerId);
+  if (largestId >= (int)territoriesOwnedById.size())
+  {
+    territoriesOwnedById.resize(largestId + 1, 0);
+  }
+
+  if (oldOwnerId >= 0)
+  {
+    if (--territoriesOwnedById[oldOwnerId] == 0)
+    {
+      eliminatedPlayerIds.push_back(oldOwnerId);
+    }
+    if (winningPlayer != nullptr && winningPlayer->getId() == oldOwnerId)
+    {
+      winningPlayer = nullptr;
+    }
+  }
+
+  if (newOwnerId >= 0)
+  {
+    if (++territoriesOwnedById[newOwnerId] == (int)map->getTerritories()->size())
+    {
+      winningPlayer = getPlayerById(newOwnerId);
+    }
+  }
+}
+
+/**
+ * @brief Gets the number of territories a player owns on the map.
+ * @param player The player.
+ * @return The number of territories owned.
+ */
+int GameEngine::getTerritoryCount(Player *player)
+{
+  int id = player->getId();
+  if (id < 0 || id >= (int)territoriesOwnedById.size())
+  {
+    return 0;
+  }
+  return territoriesOwnedById[id];
+}
+
+/**
+ * @brief Gets a player by its dense ID.
+ * @param id The ID of the player.
+ * @return Pointer to the player, or nullptr if the player was eliminated or the ID is unknown.
+ */
+Player *GameEngine::getPlayerById(int id)
+{
+  if (id < 0 || id >= (int)playersById.size())
+  {
+    return nullptr;
+  }
+  return playersById[id];
 }
 
 /**
@@ -309,6 +464,107 @@ GameEngine::~GameEngine()
   delete commandProcessor;
 }
 
+/**
+ * @brief Gets the number of armies a player had on the map at the end of the last round.
+ * @param player The player.
+ * @return The number of armies, or 0 before the first round ended.
+ */
+int GameEngine::getArmyCount(Player *player)
+{
+  int id = player->getId();
+  if (id < 0 || id >= (int)armiesOwnedById.size())
+  {
+    return 0;
+  }
+  return armiesOwnedById[id];
+}
+
+/**
+ * @brief Gets the negotiations of the current round.
+ * @return The diplomacy table, indexed by player ID.
+ */
+DiplomacyTable *GameEngine::getDiplomacy()
+{
+  return &diplomacy;
+}
+
+/**
+ * @brief Gets the symbol table holding the names of the players.
+ * @return The symbol table.
+ */
+SymbolTable *GameEngine::getPlayerNames()
+{
+  return &playerNames;
+}
+
+/**
+ * @brief Records every following game to a replay file.
+ * @param fileName The replay file, truncated first, or an empty string to stop recording.
+ * @throws std::runtime_error if the file cannot be created.
+ */
+void GameEngine::recordReplays(const std::string &fileName)
+{
+  replay.open(fileName);
+}
+
+/**
+ * @brief Gets the ID of an order's territory.
+ * @param territory The territory, or nullptr.
+ * @return The ID of the territory, or -1.
+ */
+static int32_t replayTerritory(Territory *territory)
+{
+  return territory ? territory->getId() : -1;
+}
+
+/**
+ * @brief Describes an order the way it is stored in replays.
+ * @param order The order.
+ * @param playerId The ID of the player issuing the order.
+ * @return The kind of order and its parameters.
+ */
+static ReplayOrder replayOrder(Order *order, int playerId)
+{
+  ReplayOrder record;
+  record.player = playerId;
+  if (auto deploy = dynamic_cast<Deploy *>(order))
+  {
+    record.event = RE_Deploy;
+    record.target = replayTerritory(deploy->getTarget());
+    record.armies = deploy->getAmount();
+  }
+  else if (auto advance = dynamic_cast<Advance *>(order))
+  {
+    record.event = RE_Advance;
+    record.source = replayTerritory(advance->getSource());
+    record.target = replayTerritory(advance->getTarget());
+    record.armies = advance->getAmount();
+  }
+  else if (auto airlift = dynamic_cast<Airlift *>(order))
+  {
+    record.event = RE_Airlift;
+    record.source = replayTerritory(airlift->getSource());
+    record.target = replayTerritory(airlift->getTarget());
+    record.armies = airlift->getAmount();
+  }
+  else if (auto bomb = dynamic_cast<Bomb *>(order))
+  {
+    record.event = RE_Bomb;
+    record.target = replayTerritory(bomb->getTarget());
+  }
+  else if (auto blockade = dynamic_cast<Blockade *>(order))
+  {
+    record.event = RE_Blockade;
+    record.target = replayTerritory(blockade->getTarget());
+  }
+  else if (auto negotiate = dynamic_cast<Negotiate *>(order))
+  {
+    record.event = RE_Negotiate;
+    record.target = negotiate->getTargetPlayer() ? negotiate->getTargetPlayer()->getId() : -1;
+  }
+  return record;
+}
+
 /**
  * @brief Constructor for the GameEngine class.
  * @param argc Number of command-line arguments.
@@ -317,6 +573,7 @@ GameEngine::~GameEngine()
  */
 GameEngine::GameEngine(int argc, char **argv, bool testing)
 {
+  setSeed(std::random_device()());
   this->logObserver = new LogObserver(this);
   this->map = new Map(this);
   this->deck = new Deck(this);
@@ -353,48 +610,72 @@ bool GameEngine::validateMap()
 }
 
 /**
- * @brief Validates the parameters for the tournament mode.
- * Exits the program if any parameter is invalid.
+ * @brief Gets limits that accept any tournament with at least one map, two strategies, one game and one turn.
+ * @return The unlimited bounds.
  */
-void GameEngine::validateTournament()
+TournamentLimits TournamentLimits::unlimited()
 {
-  if (allMaps.size() < 1 || allMaps.size() > 5)
-  {
-    std::cout << "GameEngine::validateTournament::Error | Number of maps must be between 1 to 5";
-    exit(0);
-  }
-  if (allPlayerStrategies.size() < 2 || allPlayerStrategies.size() > 4)
-  {
-    std::cout << "GameEngine::validateTournament::Error | Number of player strategies must be between 2 to 4";
-    exit(0);
-  }
-  if (numberOfGames < 1 || numberOfGames > 5)
+  TournamentLimits limits;
+  limits.minTurns = 1;
+  limits.maxMaps = limits.maxStrategies = limits.maxGames = limits.maxTurns = INT_MAX;
+  return limits;
+}
+
+/**
+ * @brief Replaces the tournament settings with those of a parsed tournament command.
+ * @param command The tournament command.
+ * @throws std::runtime_error if the command is not a valid tournament command.
+ */
+void GameEngine::configureTournament(const ParsedCommand &command)
+{
+  if (command.type != CMD_Tournament || !command.isValid())
   {
-    std::cout << "GameEngine::validateTournament::Error | Number of games must be between 1 to 5";
-    exit(0);
+    throw std::runtime_error("GameEngine::configureTournament::Error | Not a valid tournament command");
   }
-  if (maxNumberOfTurns < 10 || maxNumberOfTurns > 50)
+  allMaps = command.maps;
+  allPlayerStrategies = command.strategies;
+  numberOfGames = command.games;
+  maxNumberOfTurns = command.turns;
+  tournamentOutputFile = command.output;
+  tournamentFormat = Matchmaker::parseFormat(command.format);
+}
+
+/**
+ * @brief Checks that a tournament parameter is within its limits.
+ * @param value The value of the parameter.
+ * @param min The smallest value allowed.
+ * @param max The largest value allowed.
+ * @param what Description of the parameter, used in the error.
+ * @throws std::runtime_error if the value is out of bounds.
+ */
+static void validateTournamentRange(int value, int min, int max, const std::string &what)
+{
+  if (value < min || value > max)
   {
-    std::cout << "GameEngine::validateTournament::Error | Number of turns must be between 10 to 50";
-    exit(0);
+    throw std::runtime_error("GameEngine::validateTournament::Error | " + what + " must be between " + std::to_string(min) + " to " +
+                             (max == INT_MAX ? std::string("any") : std::to_string(max)));
   }
+}
+
+/**
+ * @brief Validates the parameters for the tournament mode against the tournament limits.
+ * @throws std::runtime_error if any parameter is out of bounds or a strategy is unknown.
+ */
+void GameEngine::validateTournament()
+{
+  validateTournamentRange((int)allMaps.size(), tournamentLimits.minMaps, tournamentLimits.maxMaps, "Number of maps");
+  validateTournamentRange((int)allPlayerStrategies.size(), tournamentLimits.minStrategies, tournamentLimits.maxStrategies, "Number of player strategies");
+  validateTournamentRange(numberOfGames, tournamentLimits.minGames, tournamentLimits.maxGames, "Number of games");
+  validateTournamentRange(maxNumberOfTurns, tournamentLimits.minTurns, tournamentLimits.maxTurns, "Number of turns");
   // validate strategy
-  string strategies[5] = {"Aggressive", "Benevolent", "Neutral", "Cheater", "Human"};
   int invalidStrategyCounter = 0;
 
-  for (int i = 0; i < allPlayerStrategies.size(); i++)
+  for (auto &strategy : allPlayerStrategies)
   {
-    for (int j = 0; j < 5; j++)
+    if (!PlayerStrategy::isStrategyName(strategy))
     {
-      if (allPlayerStrategies[i] == strategies[j])
-      {
-        break;
-      }
-      else if (allPlayerStrategies[i] != strategies[j] && j == 4)
-      {
-        cout << allPlayerStrategies[i] + " X NOT VALID" << endl;
-        invalidStrategyCounter++;
-      }
+      cout << strategy + " X NOT VALID" << endl;
+      invalidStrategyCounter++;
     }
   }
   if (invalidStrategyCounter > 0)
@@ -425,6 +706,10 @@ std::string GameEngine::stringToLog()
  */
 void GameEngine::reinforcementPhase()
 {
+  // Territories per player and continent, for every player in one pass over the map
+  int numContinents = (int)map->continents.size();
+  auto continentCounts = map->getStore()->countsByOwnerAndContinent((int)playersById.size(), numContinents);
+
   for (auto &player : players)
   {
     currentPlayerTurn = player;
@@ -435,7 +720,7 @@ void GameEngine::reinforcementPhase()
     int reinforcementsToAdd = 0;
 
     // Get continent bonus.
-    reinforcementsToAdd += player->getContinentBonus();
+    reinforcementsToAdd += player->getContinentBonus(continentCounts.data() + (size_t)player->getId() * numContinents);
     if (reinforcementsToAdd > 0)
     {
       cout << "Player: " << player->getName() << "'s continent bonus is: " << player->getReinforcementPool() << endl;
@@ -477,8 +762,21 @@ void GameEngine::issueOrdersPhase()
       nextTurn(phaseTurn);
       continue;
     }
+    // Stop as soon as a player owns the whole map.
+    if (winningPlayer != nullptr)
+    {
+      break;
+    }
+
     currentPlayerTurn = players[phaseTurn];
 
+    // Players eliminated during this phase have nothing left to order.
+    if (getTerritoryCount(currentPlayerTurn) == 0)
+    {
+      completed[phaseTurn] = true;
+      continue;
+    }
+
     cout << "Player: " << currentPlayerTurn->getName() << "'s turn to issue an order!" << endl;
 
     auto human = dynamic_cast<Human *>(currentPlayerTurn->getStrategy());
@@ -527,6 +825,11 @@ void GameEngine::executeOrdersPhase()
     player->setPhase("Execute Orders Phase");
   }
 
+  if (batchDeploys)
+  {
+    executeDeployPrefix(phaseTurn, completed);
+  }
+
   while (!std::all_of(completed.begin(), completed.end(), [](bool v)
                       { return v; }))
   {
@@ -549,25 +852,92 @@ void GameEngine::executeOrdersPhase()
     auto topOrder = currentPlayerOrders->at(0);
     cout << "Player: " << currentPlayerTurn->getName() << "'s order: " + topOrder->getLabel() + " is being executed." << endl;
     topOrder->execute();
+    replay.record(replayOrder(topOrder, currentPlayerTurn->getId()), *map->getStore());
     currentPlayerOrders->erase(currentPlayerOrders->cbegin());
 
     delete topOrder;
 
+    // Stop as soon as a player owns the whole map.
+    if (winningPlayer != nullptr)
+    {
+      break;
+    }
+
     nextTurn(phaseTurn);
   }
 
-  // Reset player friendly.
-  for (auto player : players)
+  // Negotiations only last for the round
+  diplomacy.reset();
+}
+
+/**
+ * @brief Executes, as one batch, the Deploy orders the round-robin would run before the first other order.
+ * Until an Advance, Bomb, Airlift, Blockade or Negotiate runs, no territory changes hands, so these Deploys give
+ * the same result whether they run one by one or together. The turn and the players that ran out of orders are
+ * left where the round-robin would have them, so the remaining orders run in the same sequence as before.
+ * @param phaseTurn The turn of the round-robin, advanced past the batched orders.
+ * @param completed Whether each player has no more orders, updated for players whose orders were all Deploys.
+ */
+void GameEngine::executeDeployPrefix(int &phaseTurn, std::vector<bool> &completed)
+{
+  std::vector<size_t> taken(players.size(), 0);
+  std::vector<Deploy *> batch;
+
+  while (!std::all_of(completed.begin(), completed.end(), [](bool v)
+                      { return v; }))
   {
-    player->clearFriendly();
+    if (completed[phaseTurn])
+    {
+      nextTurn(phaseTurn);
+      continue;
+    }
+    auto playerOrders = players[phaseTurn]->getOrdersListObject()->getList();
+    if (taken[phaseTurn] == playerOrders->size())
+    {
+      cout << "Player: " << players[phaseTurn]->getName() << " has no more orders to execute." << endl;
+      completed[phaseTurn] = true;
+      continue;
+    }
+    auto deploy = dynamic_cast<Deploy *>(playerOrders->at(taken[phaseTurn]));
+    if (deploy == nullptr)
+    {
+      break;
+    }
+    batch.push_back(deploy);
+    replay.record(replayOrder(deploy, players[phaseTurn]->getId()), *map->getStore());
+    taken[phaseTurn]++;
+    nextTurn(phaseTurn);
+  }
+
+  if (batch.empty())
+  {
+    return;
+  }
+  int executed = Deploy::executeBatch(batch);
+  ReplayOrder batchChanges;
+  batchChanges.event = RE_DeployBatch;
+  replay.record(batchChanges, *map->getStore());
+  cout << executed << " of " << batch.size() << " Deploy orders executed in one batch." << endl;
+
+  for (size_t p = 0; p < players.size(); p++)
+  {
+    auto playerOrders = players[p]->getOrdersListObject()->getList();
+    for (size_t i = 0; i < taken[p]; i++)
+    {
+      delete playerOrders->at(i);
+    }
+    playerOrders->erase(playerOrders->begin(), playerOrders->begin() + taken[p]);
   }
 }
 
 /**
  * @brief Main game loop that iterates through rounds until a win state is reached or a draw is declared.
+ * While a tournament is checkpointed, the game is captured at the start of every checkpointRounds-th round.
  * @param maxRounds Maximum number of rounds before declaring a draw.
+ * @param firstRound The round to start from, when resuming a game.
+ * @param unchangedRounds Rounds in a row that already ended with the same owners, when resuming a game.
  */
-void GameEngine::mainGameLoop(int maxRounds)
+void GameEngine::mainGameLoop(int maxRounds, int firstRound, int unchangedRounds)
 {
   if (players.empty())
   {
@@ -575,18 +945,47 @@ void GameEngine::mainGameLoop(int maxRounds)
   }
   Player *winner;
   // Check win state.
-  int round = 0;
+  int round = firstRound;
   isDraw = false;
 
+  // Players that never received a territory are eliminated right away.
+  for (auto &player : players)
+  {
+    if (getTerritoryCount(player) == 0)
+    {
+      eliminatedPlayerIds.push_back(player->getId());
+    }
+  }
+
+  // Stalemate detection: rounds in a row that left every territory with the same owner
+  uint64_t lastOwnershipHash = map->getStore()->ownershipHash();
+
+  std::vector<std::string> playerNames;
+  for (auto player : playersById)
+  {
+    playerNames.push_back(player ? player->getName() : "");
+  }
+  replay.beginGame(seed, map->getName(), playerNames, *map->getStore());
+
   while ((winner = checkWinState()) == nullptr)
   {
     cout << "-----------------------------------------------------------------------" << endl;
     cout << "Round: " << round << "" << endl;
     cout << "-----------------------------------------------------------------------" << endl;
+    replay.beginRound(round);
     removePlayersWithNoTerritories();
+    if (checkpointing && checkpointRounds > 0 && round > firstRound && round % checkpointRounds == 0)
+    {
+      progress.hasGame = true;
+      progress.game = captureGame(round, unchangedRounds);
+      progress.save(checkpointFile);
+    }
     reinforcementPhase();
     issueOrdersPhase();
+    // Strategies such as the Cheater change territories without issuing orders
+    replay.record(ReplayOrder(), *map->getStore(), false);
     executeOrdersPhase();
+    armiesOwnedById = map->getStore()->armiesByOwner((int)playersById.size());
     round++;
     if (round > maxRounds)
     {
@@ -594,7 +993,19 @@ void GameEngine::mainGameLoop(int maxRounds)
       isDraw = true;
       break;
     }
+
+    uint64_t ownershipHash = map->getStore()->ownershipHash();
+    unchangedRounds = ownershipHash == lastOwnershipHash ? unchangedRounds + 1 : 0;
+    lastOwnershipHash = ownershipHash;
+    if (stalemateRounds > 0 && unchangedRounds >= stalemateRounds && winningPlayer == nullptr && !canMakeProgress())
+    {
+      cout << "No player can make progress anymore. Draw.." << endl;
+      isDraw = true;
+      break;
+    }
   }
+  roundsPlayed = round;
+  replay.endGame(isDraw ? -1 : winner->getId(), roundsPlayed, *map->getStore());
 
   if (!isDraw)
   {
@@ -604,6 +1015,41 @@ void GameEngine::mainGameLoop(int maxRounds)
   setCurrentState(GE_Win);
 }
 
+/**
+ * @brief Checks whether any remaining player could still take a territory from another player.
+ * Only asked once ownership has been stable for a while, so the attackable sets are rarely built.
+ * @return True if a player that is not passive has a territory it can attack, false otherwise.
+ */
+bool GameEngine::canMakeProgress()
+{
+  for (auto player : players)
+  {
+    if (getTerritoryCount(player) > 0 && !player->getStrategy()->isPassive() && player->getAttackableSet().any())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Gets the number of rounds the last game lasted.
+ * @return The number of rounds played.
+ */
+int GameEngine::getRoundsPlayed() const
+{
+  return roundsPlayed;
+}
+
+/**
+ * @brief Gets the player that conquered the whole map in the last game.
+ * @return Pointer to the winning player or nullptr if there is none or the game was a draw.
+ */
+Player *GameEngine::getWinningPlayer()
+{
+  return winningPlayer;
+}
+
 /**
  * @brief Checks if a win state has been reached by a player having all territories.
  * @return Pointer to the winning player or nullptr if no win state is reached.
@@ -615,15 +1061,10 @@ Player *GameEngine::checkWinState()
     throw std::runtime_error("checkWinState::Assert Map is null.");
   }
 
-  int totalAmountOfTerritories = (int)map->getTerritories()->size();
-
-  for (auto &player : players)
+  // The winner is raised by onTerritoryOwnerChanged, make sure it still holds every territory.
+  if (winningPlayer != nullptr && getTerritoryCount(winningPlayer) == (int)map->getTerritories()->size())
   {
-    // Check if a player has all the territories.
-    if (player->getTerritories()->size() == totalAmountOfTerritories)
-    {
-      return player;
-    }
+    return winningPlayer;
   }
   return nullptr;
 }
@@ -652,27 +1093,24 @@ void GameEngine::setCurrentPlayer(Player *player)
  */
 void GameEngine::removePlayersWithNoTerritories()
 {
-  auto playersToBeDeleted = vector<Player *>();
-
-  for (auto &player : players)
+  for (int id : eliminatedPlayerIds)
   {
-    if (player->getTerritories()->empty())
+    // The player may have been removed already or reconquered a territory since the event was raised.
+    Player *player = getPlayerById(id);
+    if (player == nullptr || getTerritoryCount(player) != 0)
     {
-      playersToBeDeleted.push_back(player);
+      continue;
     }
-  }
 
-  // Remove from the game.
-  players.erase(std::remove_if(players.begin(), players.end(), [&](Player *p)
-                               { return p->getTerritories()->empty(); }),
-                players.end());
+    // Remove from the game.
+    players.erase(std::remove(players.begin(), players.end(), player), players.end());
 
-  // Free memory.
-  for (auto &player : playersToBeDeleted)
-  {
+    // Free memory.
     cout << player->getName() << " has been conquered!" << endl;
+    playersById[id] = nullptr;
     delete player;
   }
+  eliminatedPlayerIds.clear();
 }
 
 /**
@@ -698,13 +1136,6 @@ FileCommandProcessorAdapter *GameEngine::getFileCommandProcessorAdapter()
  */
 void GameEngine::resetGame()
 {
-  if (multipleTournaments)
-  {
-    allPlayerStrategies = {};
-    numberOfGames = 0;
-    maxNumberOfTurns = 0;
-  }
-
   for (auto player : players)
   {
     delete player;
@@ -717,6 +1148,12 @@ void GameEngine::resetGame()
   delete logObserver;
 
   this->players = vector<Player *>();
+  this->playersById = vector<Player *>();
+  this->territoriesOwnedById = vector<int>();
+  this->armiesOwnedById = vector<int>();
+  this->diplomacy = DiplomacyTable();
+  this->eliminatedPlayerIds = vector<int>();
+  this->winningPlayer = nullptr;
   this->currentPlayerTurn = nullptr;
   this->logObserver = new LogObserver(this);
   this->map = new Map(this);
@@ -725,11 +1162,8 @@ void GameEngine::resetGame()
   this->flr = new FileLineReader();
   this->resetObservers();
 
-  if (!multipleTournaments)
-  {
-    delete commandProcessor;
-    this->commandProcessor = new CommandProcessor(this, argc, argv);
-  }
+  delete commandProcessor;
+  this->commandProcessor = new CommandProcessor(this, argc, argv);
 
   Subject::attach((ILogObserver *)logObserver);
 }
@@ -745,49 +1179,370 @@ bool GameEngine::isTesting() const
 
 /**
  * @brief Runs the tournament mode of the game, playing multiple games on multiple maps with different strategies.
+ * With a checkpoint file set, a free-for-all tournament saves its progress after every game and every
+ * checkpointRounds rounds; with resumeTournament set, it skips the games finished before the checkpoint, appends to
+ * the results file they were streamed to and continues the game in flight from its snapshot.
+ * @return The number of games played: every pairing in a head-to-head format, and only the games on valid maps
+ * not already finished in the checkpoint for a free-for-all.
+ * @throws std::runtime_error if the output file cannot be opened, or the checkpoint belongs to another tournament.
  */
-void GameEngine::runTournament()
+int GameEngine::runTournament()
 {
   tournamentEnd = false;
+  tournamentResults.clear();
+  tournamentWins.clear();
+  tournamentLeaderboard.clear();
+
+  // A resumed free-for-all appends to the results its earlier run streamed, so it is set up before the file is opened
+  bool resuming = false;
+  progress = TournamentCheckpoint();
+  progress.maps = allMaps;
+  progress.strategies = allPlayerStrategies;
+  progress.games = numberOfGames;
+  progress.maxTurns = maxNumberOfTurns;
+  if (tournamentFormat == MF_FreeForAll && resumeTournament && !checkpointFile.empty() &&
+      std::ifstream(checkpointFile).good())
+  {
+    TournamentCheckpoint saved = TournamentCheckpoint::load(checkpointFile);
+    if (!saved.sameTournament(progress))
+    {
+      throw std::runtime_error("GameEngine::runTournament::Error | " + checkpointFile + " belongs to another tournament");
+    }
+    progress = saved;
+    resuming = true;
+    tournamentWins.insert(progress.wins.begin(), progress.wins.end());
+  }
+
+  std::ofstream csv;
+  if (!tournamentOutputFile.empty())
+  {
+    // Rows written after the last checkpoint belong to games that are played again
+    bool appending = resuming && progress.outputBytes > 0 && std::ifstream(tournamentOutputFile).good();
+    if (appending && !truncateFile(tournamentOutputFile, progress.outputBytes))
+    {
+      throw std::runtime_error("GameEngine::runTournament::Error | Could not truncate " + tournamentOutputFile);
+    }
+    csv.open(tournamentOutputFile, std::ios::out | (appending ? std::ios::app : std::ios::trunc));
+    if (!csv.is_open())
+    {
+      throw std::runtime_error("GameEngine::runTournament::Error | Could not open " + tournamentOutputFile);
+    }
+    if (!appending && tournamentFormat == MF_FreeForAll)
+    {
+      csv << "map,game,winner\n";
+    }
+  }
+
+  if (tournamentFormat != MF_FreeForAll)
+  {
+    Matchmaker matchmaker(allPlayerStrategies, allMaps, numberOfGames, maxNumberOfTurns);
+    if (csv.is_open())
+    {
+      matchmaker.setResultStream(&csv);
+    }
+    int gamesPlayed = matchmaker.run(tournamentFormat);
+    tournamentLeaderboard = matchmaker.getLeaderboard();
+    tournamentEnd = true;
+    Subject::notify(this);
+    return gamesPlayed;
+  }
+
+  checkpointing = !checkpointFile.empty();
+
+  int gamesPlayed;
+  try
+  {
+    gamesPlayed = runFreeForAll(csv);
+  }
+  catch (...)
+  {
+    checkpointing = false;
+    throw;
+  }
+  checkpointing = false;
+  tournamentEnd = true;
+  Subject::notify(this);
+  return gamesPlayed;
+}
+
+/**
+ * @brief Plays every game of a free-for-all tournament, skipping those finished before the checkpoint.
+ * @param csv The stream results are written to, or a closed stream to keep them in tournamentResults.
+ * @return The number of games played, leaving out those finished before the checkpoint.
+ */
+int GameEngine::runFreeForAll(std::ofstream &csv)
+{
+  int gamesPlayed = 0;
   for (int i = 0; i < allMaps.size(); i++)
   {
-    loadMap(allMaps[i]);
     std::vector<std::string> currMap{};
     currMap.push_back(allMaps.at(i));
-    int localNumGames = numberOfGames;
-    int localMaxTurns = maxNumberOfTurns;
-    std::vector<std::string> localAllPlayerStrategies = allPlayerStrategies;
-    if (validateMap())
+    loadMap(allMaps[i]);
+    bool mapIsValid = validateMap();
+    resetGame();
+    state = GE_Tournament;
+
+    if (mapIsValid)
     {
-      for (int j = 0; j < localNumGames; j++)
+      for (int j = 0; j < numberOfGames; j++)
       {
-        generateRandomDeck();
-        for (auto &allPlayerStrategie : localAllPlayerStrategies)
+        if (progress.isFinished(i, j))
+        {
+          // Played by the run that saved the checkpoint, whose row is already in the results file
+          if (!csv.is_open())
+          {
+            currMap.push_back("(earlier run)");
+          }
+          continue;
+        }
+
+        // The snapshot is copied, as the game overwrites it with its own checkpoints
+        bool resuming = progress.hasGame && progress.gameMap == i && progress.gameNumber == j;
+        GameSnapshot snapshot = resuming ? progress.game : GameSnapshot();
+        progress.hasGame = false;
+        progress.gameMap = i;
+        progress.gameNumber = j;
+        std::string winner = playGame(allMaps[i], allPlayerStrategies, maxNumberOfTurns, resuming ? &snapshot : nullptr);
+        gamesPlayed++;
+
+        // Streamed games are written out right away, so memory does not grow with the number of games
+        if (csv.is_open())
         {
-          new Player(this, new Hand(), allPlayerStrategie, allPlayerStrategie);
+          csv << allMaps[i] << ',' << j + 1 << ',' << winner << '\n';
+          tournamentWins[winner]++;
+        }
+        else
+        {
+          currMap.push_back(winner);
+        }
+        if (checkpointing)
+        {
+          // The row is on disk before the checkpoint that counts it
+          if (csv.is_open())
+          {
+            csv.flush();
+            progress.outputBytes = (uint64_t)csv.tellp();
+          }
+          progress.addResult(i, j, winner);
+          progress.save(checkpointFile);
         }
-        assignCardsEvenly();
-        distributeTerritories();
-        mainGameLoop(localMaxTurns);
-        currMap.push_back(isDraw ? "draw" : checkWinState()->getName());
-
-        resetGame();
-        state = GE_Tournament;
-        loadMap(allMaps[i]);
       }
-      resetGame();
     }
     else
     {
       std::cout << "" << std::endl;
       std::cout << "Map " + std::to_string(i + 1) + " is invalid" << std::endl;
-      resetGame();
-      state = GE_Tournament;
+      if (csv.is_open() && !progress.isFinished(i, 0))
+      {
+        csv << allMaps[i] << ",0,invalid\n";
+      }
+    }
+    if (csv.is_open())
+    {
+      csv.flush();
+    }
+    else
+    {
+      tournamentResults.push_back(currMap);
     }
-    tournamentResults.push_back(currMap);
   }
-  tournamentEnd = true;
-  Subject::notify(this);
+  return gamesPlayed;
+}
+
+/**
+ * @brief Plays one computer game from start to finish and resets the engine afterwards.
+ * A new game draws its own seed from the engine's generator, so every game of a tournament records a seed it can be
+ * played again from, rather than the seed of the whole tournament.
+ * @param mapFile The map to play on.
+ * @param strategies The strategy of each player.
+ * @param maxTurns The number of rounds after which the game is a draw.
+ * @param resumeFrom A snapshot of the game to continue from, or nullptr to start a new game.
+ * @return The name of the winning player, or "draw".
+ * @throws std::runtime_error if the map cannot be loaded or is invalid.
+ */
+std::string GameEngine::playGame(const std::string &mapFile, const std::vector<std::string> &strategies, int maxTurns,
+                                 const GameSnapshot *resumeFrom)
+{
+  if (resumeFrom == nullptr)
+  {
+    return playSeededGame((uint32_t)rng(), mapFile, strategies, maxTurns);
+  }
+  return runGame(mapFile, strategies, maxTurns, resumeFrom);
+}
+
+/**
+ * @brief Plays one computer game from a given seed and resets the engine afterwards.
+ * @param gameSeed The seed the game starts from, e.g. the one a replay recorded.
+ * @param mapFile The map to play on.
+ * @param strategies The strategy of each player.
+ * @param maxTurns The number of rounds after which the game is a draw.
+ * @return The name of the winning player, or "draw".
+ * @throws std::runtime_error if the map cannot be loaded or is invalid.
+ */
+std::string GameEngine::playSeededGame(uint32_t gameSeed, const std::string &mapFile,
+                                       const std::vector<std::string> &strategies, int maxTurns)
+{
+  setSeed(gameSeed);
+  return runGame(mapFile, strategies, maxTurns, nullptr);
+}
+
+/**
+ * @brief Plays one computer game from start to finish with the generator as it is, and resets the engine afterwards.
+ * Players are named after their strategy, so the winner is reported by strategy name.
+ * @param mapFile The map to play on.
+ * @param strategies The strategy of each player.
+ * @param maxTurns The number of rounds after which the game is a draw.
+ * @param resumeFrom A snapshot of the game to continue from, or nullptr to start a new game.
+ * @return The name of the winning player, or "draw".
+ * @throws std::runtime_error if the map cannot be loaded or is invalid.
+ */
+std::string GameEngine::runGame(const std::string &mapFile, const std::vector<std::string> &strategies, int maxTurns,
+                                const GameSnapshot *resumeFrom)
+{
+  GameEngineState previousState = state;
+  loadMap(mapFile);
+  if (!validateMap())
+  {
+    resetGame();
+    throw std::runtime_error("GameEngine::playGame::Error | Map " + mapFile + " is invalid");
+  }
+
+  if (resumeFrom != nullptr)
+  {
+    restoreGame(*resumeFrom);
+    mainGameLoop(maxTurns, resumeFrom->round, resumeFrom->unchangedRounds);
+  }
+  else
+  {
+    generateRandomDeck();
+    for (auto &strategy : strategies)
+    {
+      new Player(this, new Hand(), strategy, strategy);
+    }
+    assignCardsEvenly();
+    distributeTerritories();
+    mainGameLoop(maxTurns);
+  }
+  std::string winner = isDraw ? "draw" : checkWinState()->getName();
+
+  resetGame();
+  state = previousState;
+  return winner;
+}
+
+/**
+ * @brief Captures the game at the start of a round.
+ * @param round The round about to be played.
+ * @param unchangedRounds Rounds in a row that ended with the same owners.
+ * @return The snapshot.
+ */
+GameSnapshot GameEngine::captureGame(int round, int unchangedRounds)
+{
+  GameSnapshot snapshot;
+  snapshot.round = round;
+  snapshot.unchangedRounds = unchangedRounds;
+  snapshot.playerIds = (int32_t)playersById.size();
+  for (auto player : players)
+  {
+    PlayerSnapshot saved;
+    saved.id = player->getId();
+    saved.name = player->getName();
+    saved.strategy = player->getStrategy()->getName();
+    saved.reinforcementPool = player->getReinforcementPool();
+    for (int type = 0; type < CARD_TYPE_COUNT; type++)
+    {
+      saved.hand.push_back(player->getHand()->count((CardType)type));
+    }
+    if (auto neutral = dynamic_cast<Neutral *>(player->getStrategy()))
+    {
+      saved.territoriesLastTurn = neutral->getTerritoriesLastTurn();
+    }
+    snapshot.players.push_back(saved);
+  }
+  snapshot.armies = map->getStore()->armies;
+  snapshot.owner = map->getStore()->owner;
+  snapshot.deck = deck->getDrawOrder();
+  snapshot.seed = seed;
+  std::stringstream rngState;
+  rngState << rng;
+  snapshot.rng = rngState.str();
+  return snapshot;
+}
+
+/**
+ * @brief Rebuilds a captured game on the loaded map.
+ * Players are recreated with their old IDs, leaving the slots of eliminated players empty, so the owners stored
+ * with the territories still point at the right players.
+ * @param snapshot The snapshot, taken on the same map.
+ * @throws std::runtime_error if the snapshot does not fit the map.
+ */
+void GameEngine::restoreGame(const GameSnapshot &snapshot)
+{
+  auto territories = map->getTerritories();
+  if (snapshot.armies.size() != territories->size())
+  {
+    throw std::runtime_error("GameEngine::restoreGame::Error | The snapshot has " + std::to_string(snapshot.armies.size()) +
+                             " territories, the map has " + std::to_string(territories->size()));
+  }
+
+  std::vector<const PlayerSnapshot *> byId(snapshot.playerIds, nullptr);
+  for (auto &saved : snapshot.players)
+  {
+    byId.at(saved.id) = &saved;
+  }
+  std::vector<Player *> created(snapshot.playerIds, nullptr);
+  for (int id = 0; id < snapshot.playerIds; id++)
+  {
+    if (byId[id] == nullptr)
+    {
+      playersById.push_back(nullptr);
+      continue;
+    }
+    const PlayerSnapshot &saved = *byId[id];
+    Player *player = new Player(this, new Hand(), saved.name, saved.strategy);
+    player->setReinforcementPool(saved.reinforcementPool);
+    for (int type = 0; type < (int)saved.hand.size(); type++)
+    {
+      for (int card = 0; card < saved.hand[type]; card++)
+      {
+        player->getHand()->addToHand((CardType)type);
+      }
+    }
+    if (auto neutral = dynamic_cast<Neutral *>(player->getStrategy()))
+    {
+      neutral->setTerritoriesLastTurn(saved.territoriesLastTurn);
+    }
+    created[id] = player;
+  }
+  diplomacy.resize((int)playersById.size());
+
+  // Turn order
+  players.clear();
+  for (auto &saved : snapshot.players)
+  {
+    players.push_back(created[saved.id]);
+  }
+
+  for (size_t id = 0; id < territories->size(); id++)
+  {
+    Territory *territory = territories->at(id);
+    int32_t owner = snapshot.owner[id];
+    if (owner >= 0)
+    {
+      if (owner >= snapshot.playerIds || created[owner] == nullptr)
+      {
+        throw std::runtime_error("GameEngine::restoreGame::Error | Territory " + territory->getName() + " is owned by an unknown player");
+      }
+      created[owner]->addTerritory(*territory);
+    }
+    territory->setArmies(snapshot.armies[id]);
+  }
+
+  deck->setDrawOrder(snapshot.deck);
+  // The game keeps the seed it started from, which its replay records
+  seed = snapshot.seed;
+  std::stringstream rngState(snapshot.rng);
+  rngState >> rng;
 }
 
 /**
@@ -802,9 +1557,9 @@ std::string GameEngine::getTournamentResults()
   const int nameWidth = 15;
   str << "Tournament Mode: " << endl;
   str << "M: ";
-  for (int i = 0; i < tournamentResults.size(); i++)
+  for (int i = 0; i < allMaps.size(); i++)
   {
-    str << (tournamentResults.at(i))[0] << ((i != tournamentResults.size() - 1) ? ',' : ' ');
+    str << allMaps.at(i) << ((i != allMaps.size() - 1) ? ',' : ' ');
   }
   str << endl
       << "P: ";
@@ -815,6 +1570,21 @@ std::string GameEngine::getTournamentResults()
   str << endl
       << "G: " << numberOfGames << endl
       << "D: " << maxNumberOfTurns << endl;
+  if (!tournamentLeaderboard.empty())
+  {
+    str << (tournamentFormat == MF_Swiss ? "Swiss" : "Round robin") << " leaderboard:" << endl
+        << tournamentLeaderboard;
+    return str.str();
+  }
+  if (!tournamentOutputFile.empty())
+  {
+    str << "Games streamed to " << tournamentOutputFile << endl;
+    for (auto &wins : tournamentWins)
+    {
+      str << std::left << std::setw(nameWidth) << std::setfill(separator) << wins.first << wins.second << endl;
+    }
+    return str.str();
+  }
   str << std::left << std::setw(mapNameWidth) << std::setfill(separator) << "Map Name";
 
   for (int s = 1; s <= numberOfGames; s++)
@@ -842,8 +1612,6 @@ std::string GameEngine::getTournamentResults()
  */
 void GameEngine::generateRandomDeck(int deckSize)
 {
-  std::random_device rd;
-  std::mt19937 gen(rd());
   std::uniform_int_distribution<> distribution(0, 4);
 
   CardType cardOptions[5] = {
@@ -855,8 +1623,8 @@ void GameEngine::generateRandomDeck(int deckSize)
 
   for (int i = 0; i < deckSize; i++)
   {
-    int randomNum = distribution(gen);
-    deck->addCardToDeck(new Card(cardOptions[randomNum], this));
+    int randomNum = distribution(rng);
+    deck->addCardToDeck(cardOptions[randomNum]);
   }
 }
 
@@ -867,10 +1635,10 @@ void GameEngine::assignCardsEvenly()
 {
   for (auto &player : players)
   {
-    player->getHand()->addToHand(new Card(CardType::CT_Reinforcement, this));
-    player->getHand()->addToHand(new Card(CardType::CT_Blockade, this));
-    player->getHand()->addToHand(new Card(CardType::CT_Bomb, this));
-    player->getHand()->addToHand(new Card(CardType::CT_Diplomacy, this));
-    player->getHand()->addToHand(new Card(CardType::CT_Airlift, this));
+    player->getHand()->addToHand(CardType::CT_Reinforcement);
+    player->getHand()->addToHand(CardType::CT_Blockade);
+    player->getHand()->addToHand(CardType::CT_Bomb);
+    player->getHand()->addToHand(CardType::CT_Diplomacy);
+    player->getHand()->addToHand(CardType::CT_Airlift);
   }
 }
@@ -1,14 +1,23 @@
 #pragma once
 
+#include <fstream>
 #include <string>
 #include <stdexcept>
 #include <vector>
+#include <map>
+#include <random>
 #include "Player/Player.h"
 #include "Map/Map.h"
+#include "Map/SymbolTable.h"
 #include "Logger/LogObserver.h"
 #include "CommandFile/FileCommandProcessorAdapter.h"
 #include "CommandFile/FileLineReader.h"
 #include "Command/Command.h"
+#include "Command/CommandParser.h"
+#include "Matchmaker.h"
+#include "DiplomacyTable.h"
+#include "ReplayJournal.h"
+#include "TournamentCheckpoint.h"
 
 class Player;
 class Map;
@@ -29,6 +38,29 @@ enum GameEngineState {
   GE_Win
 };
 
+/**
+ * @brief Inclusive bounds accepted for the parameters of a tournament.
+ *
+ * The defaults are the limits of the assignment; experiments can raise them up to unlimited().
+ */
+struct TournamentLimits {
+  int minMaps = 1;
+  int maxMaps = 5;
+  int minStrategies = 2;
+  int maxStrategies = 4;
+  int minGames = 1;
+  int maxGames = 5;
+  int minTurns = 10;
+  int maxTurns = 50;
+
+  /**
+   * @brief Gets limits that accept any tournament with at least one map, two strategies, one game and one turn.
+   *
+   * @return The unlimited bounds.
+   */
+  static TournamentLimits unlimited();
+};
+
 /**
  * @brief Main class representing the game engine.
  */
@@ -41,15 +73,43 @@ private:
   std::string fileName;
   Player* currentPlayerTurn = nullptr;
   std::vector<Player*> players;
+  // Players indexed by their ID; slots of eliminated players are set to nullptr
+  std::vector<Player*> playersById;
+  // Territories owned per player ID, updated on every ownership change
+  std::vector<int> territoriesOwnedById;
+  // Armies owned per player ID, taken at the end of every round
+  std::vector<int> armiesOwnedById;
+  // Negotiations of the current round, between player IDs
+  DiplomacyTable diplomacy;
+  // Names of the players, kept across games so a tournament interns each name once
+  SymbolTable playerNames;
+  // Records every game to a replay file when one is set
+  ReplayRecorder replay;
+  // Progress of the running tournament, saved to checkpointFile while checkpointing is set
+  TournamentCheckpoint progress;
+  bool checkpointing = false;
+  // Player that owns every territory, raised as soon as it happens
+  Player* winningPlayer = nullptr;
+  // IDs of players that lost their last territory and have yet to be removed from the game
+  std::vector<int> eliminatedPlayerIds;
   std::vector<std::vector<std::string>> tournamentResults;
+  // Games won per player name (or "draw") by the last streamed tournament
+  std::map<std::string, int> tournamentWins;
+  // Leaderboard of the last head-to-head tournament
+  std::string tournamentLeaderboard;
 
   bool isDraw = false;
+  int roundsPlayed = 0;
   bool tournamentEnd = false;
-  std::vector<std::string> commands = {"tournament -M <mapFiles> -P <playerStrategies> -G <numGames> -D <maxTurns>", "loadmap <filename>", "validatemap", "addplayer <playername>", "gamestart", "replay", "quit"};
+  std::vector<std::string> commands = {"tournament -M <mapFiles> -P <playerStrategies> -G <numGames> -D <maxTurns> [-O <csvFile>] [-F all|roundrobin|swiss]", "loadmap <filename>", "validatemap", "addplayer <playername>", "gamestart", "replay [<replayFile>]", "quit"};
 
   // Deck
   Deck* deck = nullptr;
 
+  // Game random number generator and the seed it started from
+  uint32_t seed = 0;
+  std::mt19937 rng;
+
   // Map
   Map* map = nullptr;
 
@@ -73,8 +133,23 @@ public:
   std::vector <std::string> allPlayerStrategies;
   int numberOfGames = 0;
   int maxNumberOfTurns = 0;
-  bool multipleTournaments = false;
-  
+  // When set, tournament games are streamed to this CSV file instead of being kept for the results table
+  std::string tournamentOutputFile;
+  TournamentLimits tournamentLimits;
+  MatchFormat tournamentFormat = MF_FreeForAll;
+  // A game ends in a draw once ownership has not changed for this many rounds and no player can attack (0 disables)
+  int stalemateRounds = 5;
+  // Run the Deploy orders that open the execute orders phase as one batch instead of one by one
+  bool batchDeploys = true;
+  // When set, tournament progress is saved to this file after every game and every checkpointRounds rounds
+  std::string checkpointFile;
+  int checkpointRounds = 10;
+  // Resume the tournament saved in checkpointFile, if there is one, instead of starting over
+  bool resumeTournament = false;
+  // Set on engines played side by side by the tournament scheduler and matchmaker. They do not write to
+  // gamelog.txt, where their games would interleave
+  bool parallelRun = false;
+
   // ----------------------------------------
   // Constructors
   // ----------------------------------------
@@ -94,7 +169,17 @@ public:
   ~GameEngine() override;
 
   /**
-   * @brief Validates the tournament settings.
+   * @brief Replaces the tournament settings with those of a parsed tournament command.
+   *
+   * @param command The tournament command.
+   * @throws std::runtime_error if the command is not a valid tournament command.
+   */
+  void configureTournament(const ParsedCommand& command);
+
+  /**
+   * @brief Validates the tournament settings against the tournament limits.
+   *
+   * @throws std::runtime_error if a parameter is out of bounds or a strategy is unknown.
    */
   void validateTournament();
 
@@ -156,6 +241,14 @@ public:
   // ----------------------------------------
   void playerOrder();
 
+  /**
+   * @brief Sets up a game with the players already added: distributes territories, orders the players,
+   * builds the deck and deals the starting reinforcements and cards. Call mainGameLoop() to play it.
+   *
+   * @throws std::runtime_error if there are not enough players or the deck runs out.
+   */
+  void startGame();
+
   /**
    * @brief Retrieves the game's deck.
    *
@@ -163,6 +256,27 @@ public:
    */
   Deck* getDeck();
 
+  /**
+   * @brief Restarts the game's random number generator from a seed, so the deck deals the same cards every time.
+   *
+   * @param newSeed The seed.
+   */
+  void setSeed(uint32_t newSeed);
+
+  /**
+   * @brief Retrieves the seed the game's random number generator started from.
+   *
+   * @return The seed, drawn from std::random_device unless setSeed was called.
+   */
+  uint32_t getSeed() const;
+
+  /**
+   * @brief Retrieves the game's random number generator.
+   *
+   * @return The generator.
+   */
+  std::mt19937& getRng();
+
   /**
    * @brief Retrieves the game's map.
    *
@@ -174,8 +288,10 @@ public:
    * @brief Runs the main game loop.
    *
    * @param maxRounds Maximum number of rounds to play.
+   * @param firstRound The round to start from, when resuming a game.
+   * @param unchangedRounds Rounds in a row that already ended with the same owners, when resuming a game.
    */
-  void mainGameLoop(int maxRounds = 500);
+  void mainGameLoop(int maxRounds = 500, int firstRound = 0, int unchangedRounds = 0);
 
   /**
    * @brief Retrieves the game's logger observer.
@@ -222,8 +338,55 @@ public:
 
   /**
    * @brief Runs a tournament.
+   *
+   * @return The number of games played.
+   */
+  int runTournament();
+
+  /**
+   * @brief Plays one game between computer strategies and resets the engine afterwards.
+   * A new game starts from its own seed, drawn from the engine's generator and recorded in the replay.
+   *
+   * @param mapFile The map to play on.
+   * @param strategies The strategy of each player; players are named after their strategy.
+   * @param maxTurns The number of rounds after which the game is a draw.
+   * @param resumeFrom A snapshot of the game to continue from, or nullptr to start a new game.
+   * @return The name of the winning player, or "draw".
+   * @throws std::runtime_error if the map cannot be loaded or is invalid.
+   */
+  std::string playGame(const std::string& mapFile, const std::vector<std::string>& strategies, int maxTurns,
+                       const GameSnapshot* resumeFrom = nullptr);
+
+  /**
+   * @brief Plays one game between computer strategies from a given seed and resets the engine afterwards.
+   * Given the seed a replay recorded, it plays that game again.
+   *
+   * @param gameSeed The seed the game starts from.
+   * @param mapFile The map to play on.
+   * @param strategies The strategy of each player; players are named after their strategy.
+   * @param maxTurns The number of rounds after which the game is a draw.
+   * @return The name of the winning player, or "draw".
+   * @throws std::runtime_error if the map cannot be loaded or is invalid.
+   */
+  std::string playSeededGame(uint32_t gameSeed, const std::string& mapFile, const std::vector<std::string>& strategies,
+                             int maxTurns);
+
+  /**
+   * @brief Captures the game at the start of a round.
+   *
+   * @param round The round about to be played.
+   * @param unchangedRounds Rounds in a row that ended with the same owners.
+   * @return The snapshot.
    */
-  void runTournament();
+  GameSnapshot captureGame(int round, int unchangedRounds);
+
+  /**
+   * @brief Rebuilds a captured game on the loaded map: players, territories, cards and random number generator.
+   *
+   * @param snapshot The snapshot, taken on the same map.
+   * @throws std::runtime_error if the snapshot does not fit the map.
+   */
+  void restoreGame(const GameSnapshot& snapshot);
 
   /**
    * @brief Generates a random deck.
@@ -248,6 +411,14 @@ public:
    */
   std::vector<Player*>* getPlayers();
 
+  /**
+   * @brief Retrieves a player by its dense ID.
+   *
+   * @param id The ID of the player.
+   * @return Pointer to the player, or nullptr if the player was eliminated or the ID is unknown.
+   */
+  Player* getPlayerById(int id);
+
   /**
    * @brief Retrieves the current state of the GameEngine.
    *
@@ -255,6 +426,35 @@ public:
    */
   GameEngineState getCurrentState();
 
+  /**
+   * @brief Retrieves the Zobrist hash of the current position, for repetition checks, caches and replay verification.
+   *
+   * @return The hash of territory owners, bucketed army counts and the current phase.
+   */
+  uint64_t getStateHash();
+
+  /**
+   * @brief Converts a game state to its display name.
+   *
+   * @param engineState The state to convert.
+   * @return The display name of the state.
+   */
+  static std::string stateToString(GameEngineState engineState);
+
+  /**
+   * @brief Retrieves the player that conquered the whole map in the last game.
+   *
+   * @return The winning player, or nullptr if there is none yet or the game was a draw.
+   */
+  Player* getWinningPlayer();
+
+  /**
+   * @brief Retrieves the number of rounds the last game lasted.
+   *
+   * @return The number of rounds played.
+   */
+  int getRoundsPlayed() const;
+
   /**
    * @brief Retrieves the game's command processor.
    *
@@ -287,6 +487,57 @@ public:
    */
   void setCurrentPlayer(Player* player);
 
+  // ----------------------------------------
+  // Ownership Events
+  // ----------------------------------------
+
+  /**
+   * @brief Updates the ownership counts when a territory changes hands.
+   * Raises the "player eliminated" and "player won" events.
+   *
+   * @param oldOwnerId The ID of the previous owner, or -1 if neutral.
+   * @param newOwnerId The ID of the new owner, or -1 if neutral.
+   */
+  void onTerritoryOwnerChanged(int oldOwnerId, int newOwnerId);
+
+  /**
+   * @brief Gets the number of territories a player owns on the map.
+   *
+   * @param player The player.
+   * @return The number of territories owned.
+   */
+  int getTerritoryCount(Player* player);
+
+  /**
+   * @brief Gets the number of armies a player had on the map at the end of the last round.
+   *
+   * @param player The player.
+   * @return The number of armies, or 0 before the first round ended.
+   */
+  int getArmyCount(Player* player);
+
+  /**
+   * @brief Gets the negotiations of the current round.
+   *
+   * @return The diplomacy table, indexed by player ID.
+   */
+  DiplomacyTable* getDiplomacy();
+
+  /**
+   * @brief Gets the symbol table holding the names of the players.
+   *
+   * @return The symbol table.
+   */
+  SymbolTable* getPlayerNames();
+
+  /**
+   * @brief Records every following game, tournament games included, to a replay file.
+   *
+   * @param fileName The replay file, truncated first, or an empty string to stop recording.
+   * @throws std::runtime_error if the file cannot be created.
+   */
+  void recordReplays(const std::string& fileName);
+
 private:
   /**
    * @brief Checks the win state of the game.
@@ -295,6 +546,13 @@ private:
    */
   Player* checkWinState();
 
+  /**
+   * @brief Checks whether any remaining player could still take a territory from another player.
+   *
+   * @return True if a player that is not passive has a territory it can attack, false otherwise.
+   */
+  bool canMakeProgress();
+
   /**
    * @brief Moves on to the next turn.
    *
@@ -302,6 +560,35 @@ private:
    */
   void nextTurn(int& turn);
 
+  /**
+   * @brief Executes, as one batch, the Deploy orders the round-robin would run before the first other order.
+   *
+   * @param phaseTurn The turn of the round-robin, advanced past the batched orders.
+   * @param completed Whether each player has no more orders, updated for players whose orders were all Deploys.
+   */
+  void executeDeployPrefix(int& phaseTurn, std::vector<bool>& completed);
+
+  /**
+   * @brief Plays every game of a free-for-all tournament, skipping those finished before the checkpoint.
+   *
+   * @param csv The stream results are written to, or a closed stream to keep them in tournamentResults.
+   * @return The number of games played, leaving out those finished before the checkpoint.
+   */
+  int runFreeForAll(std::ofstream& csv);
+
+  /**
+   * @brief Plays one game between computer strategies with the generator as it is and resets the engine afterwards.
+   *
+   * @param mapFile The map to play on.
+   * @param strategies The strategy of each player; players are named after their strategy.
+   * @param maxTurns The number of rounds after which the game is a draw.
+   * @param resumeFrom A snapshot of the game to continue from, or nullptr to start a new game.
+   * @return The name of the winning player, or "draw".
+   * @throws std::runtime_error if the map cannot be loaded or is invalid.
+   */
+  std::string runGame(const std::string& mapFile, const std::vector<std::string>& strategies, int maxTurns,
+                      const GameSnapshot* resumeFrom);
+
   // ----------------------------------------
   // Remove players with no territories
   // ----------------------------------------
@@ -23,21 +23,21 @@ void testGameLoop(int argc, char **argv) {
     // add cards to the gameEngine deck
     auto deck = gameEngine.getDeck();
     // Adding cards of different types for testing
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+    deck->addCardToDeck(CardType::CT_Airlift);
+    deck->addCardToDeck(CardType::CT_Airlift);
+    deck->addCardToDeck(CardType::CT_Airlift);
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+    deck->addCardToDeck(CardType::CT_Bomb);
+    deck->addCardToDeck(CardType::CT_Bomb);
+    deck->addCardToDeck(CardType::CT_Bomb);
+    deck->addCardToDeck(CardType::CT_Blockade);
+    deck->addCardToDeck(CardType::CT_Blockade);
+    deck->addCardToDeck(CardType::CT_Blockade);
 
     // load a map before the game starts
     gameEngine.loadMap("../res/TestMap1_valid.map");
@@ -77,36 +77,36 @@ void testGameLoop(int argc, char **argv) {
 
 
         // Manually add cards to players for testing
-        player1->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-        player1->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-        player1->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-        player1->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-        player1->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-        player2->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-        player2->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-        player2->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-        player2->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-        player2->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-        player3->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-        player3->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-        player3->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-        player3->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-        player3->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-        player4->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-        player4->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-        player4->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-        player4->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-        player4->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-        player5->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-        player5->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-        player5->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-        player5->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-        player5->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-        player6->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-        player6->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-        player6->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-        player6->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-        player6->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
+        player1->getHand()->addToHand(CardType::CT_Reinforcement);
+        player1->getHand()->addToHand(CardType::CT_Blockade);
+        player1->getHand()->addToHand(CardType::CT_Bomb);
+        player1->getHand()->addToHand(CardType::CT_Diplomacy);
+        player1->getHand()->addToHand(CardType::CT_Airlift);
+        player2->getHand()->addToHand(CardType::CT_Reinforcement);
+        player2->getHand()->addToHand(CardType::CT_Blockade);
+        player2->getHand()->addToHand(CardType::CT_Bomb);
+        player2->getHand()->addToHand(CardType::CT_Diplomacy);
+        player2->getHand()->addToHand(CardType::CT_Airlift);
+        player3->getHand()->addToHand(CardType::CT_Reinforcement);
+        player3->getHand()->addToHand(CardType::CT_Blockade);
+        player3->getHand()->addToHand(CardType::CT_Bomb);
+        player3->getHand()->addToHand(CardType::CT_Diplomacy);
+        player3->getHand()->addToHand(CardType::CT_Airlift);
+        player4->getHand()->addToHand(CardType::CT_Reinforcement);
+        player4->getHand()->addToHand(CardType::CT_Blockade);
+        player4->getHand()->addToHand(CardType::CT_Bomb);
+        player4->getHand()->addToHand(CardType::CT_Diplomacy);
+        player4->getHand()->addToHand(CardType::CT_Airlift);
+        player5->getHand()->addToHand(CardType::CT_Reinforcement);
+        player5->getHand()->addToHand(CardType::CT_Blockade);
+        player5->getHand()->addToHand(CardType::CT_Bomb);
+        player5->getHand()->addToHand(CardType::CT_Diplomacy);
+        player5->getHand()->addToHand(CardType::CT_Airlift);
+        player6->getHand()->addToHand(CardType::CT_Reinforcement);
+        player6->getHand()->addToHand(CardType::CT_Blockade);
+        player6->getHand()->addToHand(CardType::CT_Bomb);
+        player6->getHand()->addToHand(CardType::CT_Diplomacy);
+        player6->getHand()->addToHand(CardType::CT_Airlift);
 
         // Start the main game loop
         gameEngine.mainGameLoop();
@@ -0,0 +1,368 @@
+#include "Matchmaker.h"
+#include "GameEngine.h"
+#include "QuietConsole.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+/**
+ * @brief Gets the match score: one point per win or bye, half a point per draw.
+ * @return The score.
+ */
+double StrategyRating::score() const
+{
+  return wins + byes + 0.5 * draws;
+}
+
+/**
+ * @brief Constructor for Matchmaker.
+ * @param strategies The strategies taking part, each at most once.
+ * @param maps The maps every pairing is played on.
+ * @param gamesPerPairing Games per pairing and map in round robin, or the number of rounds in Swiss.
+ * @param maxTurns The number of rounds after which a game is a draw.
+ * @param maxParallel The maximum number of games played at once, or 0 to use one per hardware thread.
+ * @throws std::runtime_error if fewer than two strategies are given or a strategy is listed twice.
+ */
+Matchmaker::Matchmaker(const std::vector<std::string> &strategies, const std::vector<std::string> &maps, int gamesPerPairing, int maxTurns, int maxParallel)
+    : maps(maps), gamesPerPairing(gamesPerPairing), maxTurns(maxTurns), maxParallel(maxParallel)
+{
+  if (strategies.size() < 2)
+  {
+    throw std::runtime_error("Matchmaker::Error | At least two strategies are needed");
+  }
+  for (auto &strategy : strategies)
+  {
+    // Players are named after their strategy, so the winner would be ambiguous
+    if (std::count(strategies.begin(), strategies.end(), strategy) > 1)
+    {
+      throw std::runtime_error("Matchmaker::Error | Strategy " + strategy + " is listed more than once");
+    }
+    StrategyRating rating;
+    rating.strategy = strategy;
+    ratings.push_back(rating);
+  }
+  if (this->maxParallel <= 0)
+  {
+    this->maxParallel = std::max(1, (int)std::thread::hardware_concurrency());
+  }
+}
+
+/**
+ * @brief Converts the value of the -F tournament option to a format.
+ * @param format "all", "roundrobin" or "swiss". An empty string means "all".
+ * @return The matching format.
+ * @throws std::runtime_error if the format is unknown.
+ */
+MatchFormat Matchmaker::parseFormat(const std::string &format)
+{
+  if (format.empty() || format == "all")
+  {
+    return MF_FreeForAll;
+  }
+  if (format == "roundrobin")
+  {
+    return MF_RoundRobin;
+  }
+  if (format == "swiss")
+  {
+    return MF_Swiss;
+  }
+  throw std::runtime_error("Matchmaker::Error | Unknown tournament format " + format);
+}
+
+/**
+ * @brief Gets the expected score of a player against another according to Elo.
+ * @param rating The rating of the player.
+ * @param opponentRating The rating of the opponent.
+ * @return The expected score, between 0 and 1.
+ */
+double Matchmaker::expectedScore(double rating, double opponentRating)
+{
+  return 1.0 / (1.0 + std::pow(10.0, (opponentRating - rating) / 400.0));
+}
+
+/**
+ * @brief Sets how far a single game moves the ratings.
+ * @param k The Elo K-factor.
+ */
+void Matchmaker::setKFactor(double k)
+{
+  kFactor = k;
+}
+
+/**
+ * @brief Streams every finished game as a CSV row.
+ * @param stream The stream to write to, or nullptr to stop streaming.
+ */
+void Matchmaker::setResultStream(std::ostream *stream)
+{
+  resultStream = stream;
+  if (resultStream)
+  {
+    *resultStream << "round,map,first,second,winner\n";
+  }
+}
+
+/**
+ * @brief Builds the round robin schedule.
+ * @return The games to play.
+ */
+std::vector<Match> Matchmaker::roundRobinSchedule() const
+{
+  std::vector<Match> schedule;
+  int n = (int)ratings.size();
+  for (int game = 0; game < gamesPerPairing; game++)
+  {
+    for (auto &map : maps)
+    {
+      for (int a = 0; a < n; a++)
+      {
+        for (int b = a + 1; b < n; b++)
+        {
+          Match match;
+          match.round = game + 1;
+          match.map = map;
+          match.first = game % 2 == 0 ? a : b;
+          match.second = game % 2 == 0 ? b : a;
+          schedule.push_back(match);
+        }
+      }
+    }
+  }
+  return schedule;
+}
+
+/**
+ * @brief Pairs the strategies for a Swiss round.
+ * Strategies are ranked by score, then rating. Each one, from the top, is paired with the highest ranked
+ * unpaired strategy it has not played yet, or the highest ranked unpaired one if it has played them all.
+ * @param round The round number.
+ * @param played The pairings already played, as (lower index, higher index).
+ * @param bye Set to the index of the strategy getting a bye, or -1.
+ * @return One game per pairing and map.
+ */
+std::vector<Match> Matchmaker::swissRound(int round, const std::set<std::pair<int, int>> &played, int &bye) const
+{
+  std::vector<int> ranking(ratings.size());
+  for (int i = 0; i < (int)ranking.size(); i++)
+  {
+    ranking[i] = i;
+  }
+  std::stable_sort(ranking.begin(), ranking.end(), [this](int a, int b)
+                   {
+                     if (ratings[a].score() != ratings[b].score())
+                     {
+                       return ratings[a].score() > ratings[b].score();
+                     }
+                     return ratings[a].elo > ratings[b].elo; });
+
+  std::vector<char> paired(ranking.size(), 0);
+  std::vector<Match> matches;
+  bye = -1;
+  for (int i = 0; i < (int)ranking.size(); i++)
+  {
+    if (paired[i])
+    {
+      continue;
+    }
+    int opponent = -1;
+    for (int j = i + 1; j < (int)ranking.size(); j++)
+    {
+      if (paired[j])
+      {
+        continue;
+      }
+      if (opponent == -1)
+      {
+        opponent = j;
+      }
+      if (!played.count(std::make_pair(std::min(ranking[i], ranking[j]), std::max(ranking[i], ranking[j]))))
+      {
+        opponent = j;
+        break;
+      }
+    }
+    if (opponent == -1)
+    {
+      bye = ranking[i];
+      break;
+    }
+    paired[i] = paired[opponent] = 1;
+    for (auto &map : maps)
+    {
+      Match match;
+      match.round = round;
+      match.map = map;
+      match.first = ranking[i];
+      match.second = ranking[opponent];
+      matches.push_back(match);
+    }
+  }
+  return matches;
+}
+
+/**
+ * @brief Applies the result of a finished game to the ratings and the result stream.
+ * @param match The finished game.
+ */
+void Matchmaker::recordResult(const Match &match)
+{
+  std::lock_guard<std::mutex> lock(resultMutex);
+  StrategyRating &first = ratings[match.first];
+  StrategyRating &second = ratings[match.second];
+
+  double firstScore = 0.5;
+  if (match.winner == first.strategy)
+  {
+    firstScore = 1;
+    first.wins++;
+    second.losses++;
+  }
+  else if (match.winner == second.strategy)
+  {
+    firstScore = 0;
+    first.losses++;
+    second.wins++;
+  }
+  else
+  {
+    first.draws++;
+    second.draws++;
+  }
+
+  double change = kFactor * (firstScore - expectedScore(first.elo, second.elo));
+  first.elo += change;
+  second.elo -= change;
+
+  if (resultStream)
+  {
+    *resultStream << match.round << ',' << match.map << ',' << first.strategy << ',' << second.strategy << ',' << match.winner << '\n';
+  }
+}
+
+/**
+ * @brief Plays the given games on the worker pool.
+ * Each worker owns a GameEngine and pulls the next game from a shared counter; ratings are updated as games finish.
+ * @param matches The games to play. Their winners are filled in.
+ * @throws std::runtime_error if a game could not be played.
+ */
+void Matchmaker::playMatches(std::vector<Match> &matches)
+{
+  std::atomic<size_t> next(0);
+  std::vector<std::string> errors(matches.size());
+
+  auto worker = [&]()
+  {
+    GameEngine engine(0, nullptr);
+    engine.parallelRun = true;
+    for (size_t i = next++; i < matches.size(); i = next++)
+    {
+      try
+      {
+        std::vector<std::string> players = {ratings[matches[i].first].strategy, ratings[matches[i].second].strategy};
+        matches[i].winner = engine.playGame(matches[i].map, players, maxTurns);
+        recordResult(matches[i]);
+      }
+      catch (std::runtime_error &err)
+      {
+        errors[i] = err.what();
+      }
+    }
+  };
+
+  int threadCount = std::min(maxParallel, (int)matches.size());
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threadCount; t++)
+  {
+    pool.emplace_back(worker);
+  }
+  for (auto &thread : pool)
+  {
+    thread.join();
+  }
+
+  for (auto &error : errors)
+  {
+    if (!error.empty())
+    {
+      throw std::runtime_error(error);
+    }
+  }
+}
+
+/**
+ * @brief Plays a whole tournament in the given format, with the console silenced.
+ * A Swiss tournament plays gamesPerPairing rounds, each pairing playing once on every map.
+ * @param format MF_RoundRobin or MF_Swiss.
+ * @return The number of games played; byes are not games.
+ * @throws std::runtime_error if the format is not a head-to-head format or a game could not be played.
+ */
+int Matchmaker::run(MatchFormat format)
+{
+  QuietConsole quiet;
+  int gamesPlayed = 0;
+  if (format == MF_RoundRobin)
+  {
+    std::vector<Match> schedule = roundRobinSchedule();
+    playMatches(schedule);
+    gamesPlayed += (int)schedule.size();
+  }
+  else if (format == MF_Swiss)
+  {
+    std::set<std::pair<int, int>> played;
+    for (int round = 1; round <= gamesPerPairing; round++)
+    {
+      int bye;
+      std::vector<Match> matches = swissRound(round, played, bye);
+      if (bye != -1)
+      {
+        ratings[bye].byes++;
+      }
+      for (auto &match : matches)
+      {
+        played.insert(std::make_pair(std::min(match.first, match.second), std::max(match.first, match.second)));
+      }
+      playMatches(matches);
+      gamesPlayed += (int)matches.size();
+    }
+  }
+  else
+  {
+    throw std::runtime_error("Matchmaker::Error | Free for all tournaments are run by GameEngine::runTournament");
+  }
+  return gamesPlayed;
+}
+
+/**
+ * @brief Gets the ratings of every strategy, in the order the strategies were given.
+ * @return The ratings.
+ */
+const std::vector<StrategyRating> &Matchmaker::getRatings() const
+{
+  return ratings;
+}
+
+/**
+ * @brief Formats the strategies ranked by Elo rating.
+ * @return The leaderboard table.
+ */
+std::string Matchmaker::getLeaderboard() const
+{
+  std::vector<StrategyRating> ranked = ratings;
+  std::stable_sort(ranked.begin(), ranked.end(), [](const StrategyRating &a, const StrategyRating &b)
+                   { return a.elo > b.elo; });
+
+  std::stringstream str;
+  str << std::left << std::setw(6) << "Rank" << std::setw(15) << "Strategy" << std::setw(8) << "Elo"
+      << std::setw(6) << "W" << std::setw(6) << "L" << std::setw(6) << "D" << "Score" << std::endl;
+  for (int i = 0; i < (int)ranked.size(); i++)
+  {
+    str << std::left << std::setw(6) << i + 1 << std::setw(15) << ranked[i].strategy << std::setw(8) << (int)std::lround(ranked[i].elo)
+        << std::setw(6) << ranked[i].wins << std::setw(6) << ranked[i].losses << std::setw(6) << ranked[i].draws << ranked[i].score() << std::endl;
+  }
+  return str.str();
+}
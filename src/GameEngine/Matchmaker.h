@@ -0,0 +1,180 @@
+#pragma once
+
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief How the strategies of a tournament are matched against each other.
+ */
+enum MatchFormat
+{
+  // Every strategy plays in every game (the original tournament mode)
+  MF_FreeForAll,
+  // Every pair of strategies plays head to head on every map
+  MF_RoundRobin,
+  // Each round pairs strategies with similar scores that have not met yet
+  MF_Swiss
+};
+
+/**
+ * @brief Rating and record of one strategy.
+ */
+struct StrategyRating
+{
+  std::string strategy;
+  double elo = 1500;
+  int wins = 0;
+  int losses = 0;
+  int draws = 0;
+  int byes = 0;
+
+  /**
+   * @brief Gets the match score: one point per win or bye, half a point per draw.
+   *
+   * @return The score.
+   */
+  double score() const;
+};
+
+/**
+ * @brief One head-to-head game of the schedule.
+ */
+struct Match
+{
+  int round = 0;
+  std::string map;
+  // Indices into the strategy list
+  int first = 0;
+  int second = 0;
+  // Name of the winning strategy, or "draw"
+  std::string winner;
+};
+
+/**
+ * @brief Schedules head-to-head games between strategies, plays them in parallel and keeps Elo ratings.
+ *
+ * Games are dispatched to a bounded pool of worker threads, each with its own GameEngine. Ratings are updated as
+ * soon as a game finishes, so the ratings used to pair a Swiss round always include every earlier game.
+ */
+class Matchmaker
+{
+private:
+  std::vector<std::string> maps;
+  std::vector<StrategyRating> ratings;
+  int gamesPerPairing;
+  int maxTurns;
+  int maxParallel;
+  double kFactor = 32;
+
+  // Optional CSV receiving every game as it finishes
+  std::ostream *resultStream = nullptr;
+
+  // Guards ratings and resultStream while games run
+  std::mutex resultMutex;
+
+  /**
+   * @brief Applies the result of a finished game to the ratings and the result stream.
+   *
+   * @param match The finished game.
+   */
+  void recordResult(const Match &match);
+
+  /**
+   * @brief Plays the given games on the worker pool.
+   *
+   * @param matches The games to play. Their winners are filled in.
+   * @throws std::runtime_error if a game could not be played.
+   */
+  void playMatches(std::vector<Match> &matches);
+
+public:
+  /**
+   * @brief Constructor for Matchmaker.
+   *
+   * @param strategies The strategies taking part, each at most once.
+   * @param maps The maps every pairing is played on.
+   * @param gamesPerPairing Games per pairing and map in round robin, or the number of rounds in Swiss.
+   * @param maxTurns The number of rounds after which a game is a draw.
+   * @param maxParallel The maximum number of games played at once, or 0 to use one per hardware thread.
+   * @throws std::runtime_error if fewer than two strategies are given or a strategy is listed twice.
+   */
+  Matchmaker(const std::vector<std::string> &strategies, const std::vector<std::string> &maps, int gamesPerPairing, int maxTurns, int maxParallel = 0);
+
+  /**
+   * @brief Converts the value of the -F tournament option to a format.
+   *
+   * @param format "all", "roundrobin" or "swiss". An empty string means "all".
+   * @return The matching format.
+   * @throws std::runtime_error if the format is unknown.
+   */
+  static MatchFormat parseFormat(const std::string &format);
+
+  /**
+   * @brief Gets the expected score of a player against another according to Elo.
+   *
+   * @param rating The rating of the player.
+   * @param opponentRating The rating of the opponent.
+   * @return The expected score, between 0 and 1.
+   */
+  static double expectedScore(double rating, double opponentRating);
+
+  /**
+   * @brief Sets how far a single game moves the ratings.
+   *
+   * @param k The Elo K-factor.
+   */
+  void setKFactor(double k);
+
+  /**
+   * @brief Streams every finished game as a CSV row "round,map,first,second,winner".
+   *
+   * @param stream The stream to write to, or nullptr to stop streaming.
+   */
+  void setResultStream(std::ostream *stream);
+
+  /**
+   * @brief Builds the round robin schedule: every pair of strategies on every map, gamesPerPairing times.
+   * Seats are swapped between the games of a pairing.
+   *
+   * @return The games to play.
+   */
+  std::vector<Match> roundRobinSchedule() const;
+
+  /**
+   * @brief Pairs the strategies for a Swiss round by score, then rating, avoiding rematches where possible.
+   * With an odd number of strategies the lowest unpaired one gets a bye.
+   *
+   * @param round The round number.
+   * @param played The pairings already played, as (lower index, higher index).
+   * @param bye Set to the index of the strategy getting a bye, or -1.
+   * @return One game per pairing and map.
+   */
+  std::vector<Match> swissRound(int round, const std::set<std::pair<int, int>> &played, int &bye) const;
+
+  /**
+   * @brief Plays a whole tournament in the given format.
+   *
+   * @param format MF_RoundRobin or MF_Swiss.
+   * @return The number of games played.
+   * @throws std::runtime_error if the format is not a head-to-head format or a game could not be played.
+   */
+  int run(MatchFormat format);
+
+  /**
+   * @brief Gets the ratings of every strategy, in the order the strategies were given.
+   *
+   * @return The ratings.
+   */
+  const std::vector<StrategyRating> &getRatings() const;
+
+  /**
+   * @brief Formats the strategies ranked by Elo rating.
+   *
+   * @return The leaderboard table.
+   */
+  std::string getLeaderboard() const;
+};
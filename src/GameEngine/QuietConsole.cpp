@@ -0,0 +1,46 @@
+#include "QuietConsole.h"
+
+/**
+ * @brief Stream buffer that accepts and drops every character without keeping any state.
+ */
+class NullBuffer : public std::streambuf
+{
+protected:
+  int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+  std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+static NullBuffer nullBuffer;
+
+/**
+ * @brief Points std::cout at a buffer that drops everything.
+ * When the console is already silenced (e.g. from a worker thread of a silenced run) it is left untouched,
+ * so nested instances never swap the buffer under other threads.
+ */
+QuietConsole::QuietConsole() : saved(std::cout.rdbuf())
+{
+  if (saved != &nullBuffer)
+  {
+    std::cout.rdbuf(&nullBuffer);
+  }
+}
+
+/**
+ * @brief Gives std::cout its original buffer back.
+ */
+QuietConsole::~QuietConsole()
+{
+  if (saved != &nullBuffer)
+  {
+    std::cout.rdbuf(saved);
+  }
+}
+
+/**
+ * @brief Gets the stream buffer std::cout wrote to before it was silenced.
+ * @return The original console buffer.
+ */
+std::streambuf *QuietConsole::getConsole() const
+{
+  return saved;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <iostream>
+
+/**
+ * @brief Silences std::cout for as long as it is alive.
+ *
+ * The console is pointed at a stateless stream buffer that drops everything, so threads started while it is alive
+ * can keep writing to std::cout without racing on it. Create and destroy it on the thread that owns the console.
+ */
+class QuietConsole
+{
+private:
+  std::streambuf *saved;
+
+public:
+  QuietConsole();
+  ~QuietConsole();
+
+  QuietConsole(const QuietConsole &) = delete;
+  QuietConsole &operator=(const QuietConsole &) = delete;
+
+  /**
+   * @brief Gets the stream buffer std::cout wrote to before it was silenced.
+   *
+   * @return The original console buffer.
+   */
+  std::streambuf *getConsole() const;
+};
@@ -0,0 +1,377 @@
+#include "ReplayJournal.h"
+#include "Map/TerritoryStore.h"
+#include "BinaryCodec.h"
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+const char ReplayRecorder::MAGIC[4] = {'W', 'Z', 'R', 'P'};
+const uint8_t ReplayRecorder::VERSION;
+
+/**
+ * @brief Copy constructor. The copy records to the same file, starting with its next game.
+ *
+ * @param other The recorder to copy.
+ */
+ReplayRecorder::ReplayRecorder(const ReplayRecorder &other) : fileName(other.fileName)
+{
+}
+
+/**
+ * @brief Assignment operator. The game being recorded, if any, is dropped.
+ *
+ * @param other The recorder to copy.
+ * @return This recorder.
+ */
+ReplayRecorder &ReplayRecorder::operator=(const ReplayRecorder &other)
+{
+  if (this != &other)
+  {
+    if (file.is_open())
+    {
+      file.close();
+    }
+    buffer.bytes.clear();
+    fileName = other.fileName;
+  }
+  return *this;
+}
+
+/**
+ * @brief Sets the file games are recorded to, truncating it.
+ * @param _fileName The replay file, or an empty string to stop recording.
+ * @throws std::runtime_error if the file cannot be created.
+ */
+void ReplayRecorder::open(const std::string &_fileName)
+{
+  if (file.is_open())
+  {
+    file.close();
+  }
+  buffer.bytes.clear();
+  fileName = _fileName;
+  if (fileName.empty())
+  {
+    return;
+  }
+  std::ofstream created(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!created)
+  {
+    throw std::runtime_error("ReplayRecorder::Error | Cannot create replay file " + fileName);
+  }
+  created.write(MAGIC, sizeof(MAGIC));
+  created.put((char)VERSION);
+}
+
+/**
+ * @brief Checks whether games are being recorded.
+ * @return True if a replay file is set, false otherwise.
+ */
+bool ReplayRecorder::isOpen() const
+{
+  return !fileName.empty();
+}
+
+/**
+ * @brief Writes the buffered records to the file.
+ */
+void ReplayRecorder::flush()
+{
+  if (!file.is_open() || buffer.bytes.empty())
+  {
+    return;
+  }
+  file.write(buffer.bytes.data(), (std::streamsize)buffer.bytes.size());
+  file.flush();
+  buffer.bytes.clear();
+}
+
+/**
+ * @brief Starts recording a game from its initial position, and tracking the changes made to the store.
+ * @param seed The seed of the game.
+ * @param map The name of the map.
+ * @param players The player names, indexed by player ID.
+ * @param store The territory state.
+ * @throws std::runtime_error if the replay file cannot be written.
+ */
+void ReplayRecorder::beginGame(uint32_t seed, const std::string &map, const std::vector<std::string> &players,
+                               TerritoryStore &store)
+{
+  if (!isOpen())
+  {
+    return;
+  }
+  file.close();
+  file.open(fileName, std::ios::out | std::ios::binary | std::ios::app);
+  if (!file)
+  {
+    throw std::runtime_error("ReplayRecorder::Error | Cannot write replay file " + fileName);
+  }
+
+  buffer.byte('G');
+  buffer.varint(seed);
+  buffer.string(map);
+  buffer.varint(players.size());
+  for (auto &name : players)
+  {
+    buffer.string(name);
+  }
+  buffer.varint(store.size());
+  for (int i = 0; i < store.size(); i++)
+  {
+    buffer.signedVarint(store.owner[i]);
+    buffer.signedVarint(store.armies[i]);
+  }
+  store.setTracking(true);
+}
+
+/**
+ * @brief Records the start of a round, after writing out the previous one.
+ * @param round The round number.
+ */
+void ReplayRecorder::beginRound(int round)
+{
+  if (!file.is_open())
+  {
+    return;
+  }
+  flush();
+  buffer.byte('R');
+  buffer.varint(round);
+}
+
+/**
+ * @brief Records an order with every territory changed since the last record.
+ * @param order The order, or an RE_Changes event for changes made outside of an order.
+ * @param store The territory state. Its changes are cleared.
+ * @param always Whether to write the record even when no territory changed.
+ */
+void ReplayRecorder::record(const ReplayOrder &order, TerritoryStore &store, bool always)
+{
+  if (!file.is_open())
+  {
+    return;
+  }
+  const std::vector<int32_t> &changed = store.getChanged();
+  if (changed.empty() && !always)
+  {
+    return;
+  }
+  buffer.byte('O');
+  buffer.byte(order.event);
+  buffer.signedVarint(order.player);
+  buffer.signedVarint(order.source);
+  buffer.signedVarint(order.target);
+  buffer.signedVarint(order.armies);
+  buffer.varint(changed.size());
+  for (int32_t id : changed)
+  {
+    buffer.varint(id);
+    buffer.signedVarint(store.owner[id]);
+    buffer.signedVarint(store.armies[id]);
+  }
+  store.clearChanged();
+}
+
+/**
+ * @brief Records the end of a game, writes it out and stops tracking the changes made to the store.
+ * @param winnerId The ID of the winning player, or -1 for a draw.
+ * @param rounds The number of rounds played.
+ * @param store The final territory state.
+ */
+void ReplayRecorder::endGame(int winnerId, int rounds, TerritoryStore &store)
+{
+  if (!file.is_open())
+  {
+    return;
+  }
+  store.setTracking(false);
+  buffer.byte('E');
+  buffer.signedVarint(winnerId);
+  buffer.varint(rounds);
+  buffer.fixed64(store.hash());
+  flush();
+  file.close();
+}
+
+/**
+ * @brief Plays back every game of a replay.
+ * A game without an end record, e.g. from a crashed run, is returned with the position of its last round.
+ * @param data The content of the replay file.
+ * @return The games, in the order they were recorded.
+ * @throws std::runtime_error if a record is truncated or malformed.
+ */
+std::vector<ReplayGame> ReplayPlayer::play(const std::vector<uint8_t> &data)
+{
+  if (data.size() < sizeof(ReplayRecorder::MAGIC) + 1 ||
+      memcmp(data.data(), ReplayRecorder::MAGIC, sizeof(ReplayRecorder::MAGIC)) != 0)
+  {
+    throw std::runtime_error("ReplayPlayer::Error | Not a replay file");
+  }
+  if (data[sizeof(ReplayRecorder::MAGIC)] != ReplayRecorder::VERSION)
+  {
+    throw std::runtime_error("ReplayPlayer::Error | Unsupported replay version " +
+                             std::to_string(data[sizeof(ReplayRecorder::MAGIC)]));
+  }
+
+  BinaryReader in(data.data() + sizeof(ReplayRecorder::MAGIC) + 1, data.data() + data.size(), "ReplayPlayer");
+  std::vector<ReplayGame> games;
+  TerritoryStore store;
+  bool inGame = false;
+  auto finishGame = [&]()
+  {
+    games.back().armies = store.armies;
+    games.back().owner = store.owner;
+    inGame = false;
+  };
+
+  while (!in.done())
+  {
+    uint8_t tag = in.byte();
+    if (tag != 'G' && !inGame)
+    {
+      in.fail("Record outside of a game");
+    }
+    switch (tag)
+    {
+    case 'G':
+    {
+      if (inGame)
+      {
+        finishGame();
+      }
+      ReplayGame game;
+      game.seed = (uint32_t)in.varint();
+      game.map = in.string();
+      uint64_t players = in.varint();
+      for (uint64_t p = 0; p < players; p++)
+      {
+        game.players.push_back(in.string());
+      }
+      uint64_t territories = in.varint();
+      store.clear();
+      for (uint64_t i = 0; i < territories; i++)
+      {
+        int32_t owner = in.signedVarint();
+        store.add(in.signedVarint(), owner, -1);
+      }
+      games.push_back(std::move(game));
+      inGame = true;
+      break;
+    }
+    case 'R':
+      // Rounds are only written out once complete
+      games.back().rounds = (int)in.varint() + 1;
+      break;
+    case 'O':
+    {
+      ReplayOrder order;
+      uint8_t event = in.byte();
+      if (event > RE_Negotiate)
+      {
+        in.fail("Unknown event " + std::to_string(event) + " in the replay");
+      }
+      order.event = (ReplayEvent)event;
+      order.player = in.signedVarint();
+      order.source = in.signedVarint();
+      order.target = in.signedVarint();
+      order.armies = in.signedVarint();
+      uint64_t changes = in.varint();
+      for (uint64_t c = 0; c < changes; c++)
+      {
+        uint64_t id = in.varint();
+        if (id >= (uint64_t)store.size())
+        {
+          in.fail("Territory " + std::to_string(id) + " is not on the map");
+        }
+        store.setOwner((int)id, in.signedVarint());
+        store.setArmies((int)id, in.signedVarint());
+      }
+      // A batch record only holds the changes of Deploys recorded before it
+      if (event != RE_Changes && event != RE_DeployBatch)
+      {
+        games.back().orders++;
+        games.back().issued.push_back(order);
+      }
+      break;
+    }
+    case 'E':
+    {
+      ReplayGame &game = games.back();
+      game.winner = in.signedVarint();
+      game.rounds = (int)in.varint();
+      game.hash = in.fixed64();
+      game.finished = true;
+      game.verified = game.hash == store.hash();
+      finishGame();
+      break;
+    }
+    default:
+      in.fail("Unknown record '" + std::string(1, (char)tag) + "' in the replay");
+    }
+  }
+  if (inGame)
+  {
+    finishGame();
+  }
+  return games;
+}
+
+/**
+ * @brief Reads and plays back every game of a replay file.
+ * @param fileName The replay file.
+ * @return The games, in the order they were recorded.
+ * @throws std::runtime_error if the file cannot be read, or a record is truncated or malformed.
+ */
+std::vector<ReplayGame> ReplayPlayer::playFile(const std::string &fileName)
+{
+  return play(readBinaryFile(fileName, "ReplayPlayer"));
+}
+
+/**
+ * @brief Plays back a replay file and describes every game, followed by the playback speed.
+ * @param fileName The replay file.
+ * @return The report, one line per game.
+ * @throws std::runtime_error if the file cannot be read, or a record is truncated or malformed.
+ */
+std::string ReplayPlayer::report(const std::string &fileName)
+{
+  auto start = std::chrono::steady_clock::now();
+  std::vector<ReplayGame> games = playFile(fileName);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::stringstream out;
+  long orders = 0;
+  for (size_t i = 0; i < games.size(); i++)
+  {
+    const ReplayGame &game = games[i];
+    out << "Game " << i + 1 << " on " << game.map << ": ";
+    if (!game.finished)
+    {
+      out << "unfinished";
+    }
+    else if (game.winner >= 0 && game.winner < (int)game.players.size())
+    {
+      out << game.players[game.winner] << " wins";
+    }
+    else
+    {
+      out << "draw";
+    }
+    out << " after " << game.rounds << " rounds, " << game.orders << " orders";
+    if (game.finished)
+    {
+      out << (game.verified ? ", verified" : ", FINAL POSITION MISMATCH");
+    }
+    out << std::endl;
+    orders += game.orders;
+  }
+  out << orders << " orders played back in " << (long)(seconds * 1000) << " ms";
+  if (seconds > 0)
+  {
+    out << " (" << (long)(orders / seconds) << " orders/s)";
+  }
+  return out.str();
+}
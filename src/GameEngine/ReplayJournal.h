@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BinaryCodec.h"
+
+class TerritoryStore;
+
+/**
+ * @brief The kinds of events stored in a replay.
+ */
+enum ReplayEvent : uint8_t
+{
+  // Territory changes made outside of an order, e.g. the conquests of a Cheater while issuing orders
+  RE_Changes,
+  RE_Deploy,
+  // The opening Deploys of a round, executed as one batch
+  RE_DeployBatch,
+  RE_Advance,
+  RE_Airlift,
+  RE_Bomb,
+  RE_Blockade,
+  RE_Negotiate
+};
+
+/**
+ * @brief An issued order as stored in a replay. Fields the order does not have are -1.
+ */
+struct ReplayOrder
+{
+  ReplayEvent event = RE_Changes;
+  // ID of the issuing player
+  int32_t player = -1;
+  // Territory IDs; the target of a Negotiate is the ID of the other player
+  int32_t source = -1;
+  int32_t target = -1;
+  int32_t armies = -1;
+};
+
+/**
+ * @brief Summary of one game played back from a replay.
+ */
+struct ReplayGame
+{
+  uint32_t seed = 0;
+  std::string map;
+  // Player names, indexed by player ID
+  std::vector<std::string> players;
+  int rounds = 0;
+  long orders = 0;
+  // Every issued order, in execution order
+  std::vector<ReplayOrder> issued;
+  // ID of the winning player, or -1 for a draw
+  int winner = -1;
+  // Whether the game was recorded to the end; a crashed game stops after its last complete round
+  bool finished = false;
+  // Zobrist hash of the final position, as recorded when the game ended
+  uint64_t hash = 0;
+  // Whether the final position matches the hash recorded when the game ended
+  bool verified = false;
+  // Final armies and owner per territory ID
+  std::vector<int32_t> armies;
+  std::vector<int32_t> owner;
+};
+
+/**
+ * @brief Streams games to a compact binary replay file.
+ *
+ * A game is recorded as its seed, the map name, the player names, the initial owner and armies of every territory,
+ * then one record per round and per executed order. An order record holds the order as issued (its kind, player,
+ * source, target and armies) and its resolved outcome: the new owner and armies of every territory it changed, so
+ * an attack is stored with the survivors on both sides and who ended up holding each territory. The opening
+ * Deploys of a round are executed as one batch, so each is recorded without changes and a closing RE_DeployBatch
+ * record holds the changes of the whole batch. The game ends with the winner, the number of rounds and the Zobrist
+ * hash of the final position.
+ *
+ * The changed territories are the ones the TerritoryStore lists while tracking changes, so recording an order costs
+ * as much as the territories it changed, and anything that writes to the store is captured whether it went through
+ * an order or not. Integers are written as LEB128 varints, signed ones zigzag-encoded first. Records are buffered
+ * and appended to the file at the end of every round, so a game that crashes still leaves every completed round on
+ * disk.
+ *
+ * File layout: "WZRP", a version byte, then one or more games:
+ *   'G' seed, map, player count, names..., territory count, (owner, armies)...
+ *   'R' round
+ *   'O' event, player, source, target, armies, change count, (territory, owner, armies)...
+ *   'E' winner, rounds, 8-byte hash
+ */
+class ReplayRecorder
+{
+private:
+  std::string fileName;
+  std::ofstream file;
+  BinaryWriter buffer;
+
+  /**
+   * @brief Writes the buffered records to the file.
+   */
+  void flush();
+
+public:
+  static const char MAGIC[4];
+  static const uint8_t VERSION = 2;
+
+  ReplayRecorder() = default;
+  ReplayRecorder(const ReplayRecorder &other);
+  ReplayRecorder &operator=(const ReplayRecorder &other);
+
+  /**
+   * @brief Sets the file games are recorded to, truncating it. Each recorded game is then appended to it.
+   *
+   * @param fileName The replay file, or an empty string to stop recording.
+   * @throws std::runtime_error if the file cannot be created.
+   */
+  void open(const std::string &fileName);
+
+  /**
+   * @brief Checks whether games are being recorded.
+   *
+   * @return True if a replay file is set, false otherwise.
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief Starts recording a game from its initial position, and tracking the changes made to the store.
+   *
+   * @param seed The seed of the game.
+   * @param map The name of the map.
+   * @param players The player names, indexed by player ID.
+   * @param store The territory state.
+   * @throws std::runtime_error if the replay file cannot be written.
+   */
+  void beginGame(uint32_t seed, const std::string &map, const std::vector<std::string> &players,
+                 TerritoryStore &store);
+
+  /**
+   * @brief Records the start of a round, after writing out the previous one.
+   *
+   * @param round The round number.
+   */
+  void beginRound(int round);
+
+  /**
+   * @brief Records an order with every territory changed since the last record.
+   *
+   * @param order The order, or an RE_Changes event for changes made outside of an order.
+   * @param store The territory state. Its changes are cleared.
+   * @param always Whether to write the record even when no territory changed.
+   */
+  void record(const ReplayOrder &order, TerritoryStore &store, bool always = true);
+
+  /**
+   * @brief Records the end of a game, writes it out and stops tracking the changes made to the store.
+   *
+   * @param winnerId The ID of the winning player, or -1 for a draw.
+   * @param rounds The number of rounds played.
+   * @param store The final territory state.
+   */
+  void endGame(int winnerId, int rounds, TerritoryStore &store);
+};
+
+/**
+ * @brief Fast-forwards through replay files without running any strategy.
+ *
+ * Playback only applies the recorded territory changes to a TerritoryStore, which keeps the Zobrist hash up to
+ * date, and checks the final hash of every game against the one recorded.
+ */
+class ReplayPlayer
+{
+public:
+  /**
+   * @brief Plays back every game of a replay.
+   *
+   * @param data The content of the replay file.
+   * @return The games, in the order they were recorded.
+   * @throws std::runtime_error if a record is truncated or malformed.
+   */
+  static std::vector<ReplayGame> play(const std::vector<uint8_t> &data);
+
+  /**
+   * @brief Reads and plays back every game of a replay file.
+   *
+   * @param fileName The replay file.
+   * @return The games, in the order they were recorded.
+   * @throws std::runtime_error if the file cannot be read, or a record is truncated or malformed.
+   */
+  static std::vector<ReplayGame> playFile(const std::string &fileName);
+
+  /**
+   * @brief Plays back a replay file and describes every game, e.g.
+   * "Game 1 on World: Alice wins after 12 rounds, 340 orders, verified", followed by the playback speed.
+   *
+   * @param fileName The replay file.
+   * @return The report, one line per game.
+   * @throws std::runtime_error if the file cannot be read, or a record is truncated or malformed.
+   */
+  static std::string report(const std::string &fileName);
+};
@@ -0,0 +1,252 @@
+#include "TournamentCheckpoint.h"
+#include "BinaryCodec.h"
+#include "Cards/Cards.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+const char TournamentCheckpoint::MAGIC[4] = {'W', 'Z', 'C', 'P'};
+const uint8_t TournamentCheckpoint::VERSION;
+
+/**
+ * @brief Checks whether the checkpoint was written by a tournament with the same settings.
+ * @param other The checkpoint of the tournament to resume.
+ * @return True if the maps, strategies, number of games and maximum turns are the same.
+ */
+bool TournamentCheckpoint::sameTournament(const TournamentCheckpoint &other) const
+{
+  return maps == other.maps && strategies == other.strategies && games == other.games && maxTurns == other.maxTurns;
+}
+
+/**
+ * @brief Checks whether a game was finished before the checkpoint was taken.
+ * @param map The index of the map.
+ * @param game The index of the game on that map.
+ * @return True if the game comes before the resume cursor, false otherwise.
+ */
+bool TournamentCheckpoint::isFinished(int map, int game) const
+{
+  return map < nextMap || (map == nextMap && game < nextGame);
+}
+
+/**
+ * @brief Records a finished game: counts its winner, moves the resume cursor past it and drops the snapshot.
+ * @param map The index of the map.
+ * @param game The index of the game on that map.
+ * @param winner The name of the winner, or "draw".
+ */
+void TournamentCheckpoint::addResult(int map, int game, const std::string &winner)
+{
+  wins[winner]++;
+  nextMap = map;
+  nextGame = game + 1;
+  hasGame = false;
+  this->game = GameSnapshot();
+}
+
+/**
+ * @brief Writes a list of strings.
+ * @param out The writer.
+ * @param values The strings.
+ */
+static void putStrings(BinaryWriter &out, const std::vector<std::string> &values)
+{
+  out.varint(values.size());
+  for (auto &value : values)
+  {
+    out.string(value);
+  }
+}
+
+/**
+ * @brief Reads a list of strings.
+ * @param in The reader.
+ * @return The strings.
+ */
+static std::vector<std::string> getStrings(BinaryReader &in)
+{
+  // Every string takes at least its length byte
+  std::vector<std::string> values(in.count(1));
+  for (auto &value : values)
+  {
+    value = in.string();
+  }
+  return values;
+}
+
+/**
+ * @brief Writes the checkpoint to "<fileName>.tmp", then moves it over the file.
+ * @param fileName The checkpoint file.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void TournamentCheckpoint::save(const std::string &fileName) const
+{
+  BinaryWriter out;
+  out.bytes.append(MAGIC, sizeof(MAGIC));
+  out.byte(VERSION);
+  putStrings(out, maps);
+  putStrings(out, strategies);
+  out.varint(games);
+  out.varint(maxTurns);
+
+  out.varint(nextMap);
+  out.varint(nextGame);
+  out.varint(outputBytes);
+  out.varint(wins.size());
+  for (auto &win : wins)
+  {
+    out.string(win.first);
+    out.varint(win.second);
+  }
+
+  out.byte(hasGame);
+  if (hasGame)
+  {
+    out.varint(gameMap);
+    out.varint(gameNumber);
+    out.varint(game.round);
+    out.varint(game.unchangedRounds);
+    out.varint(game.playerIds);
+    out.varint(game.players.size());
+    for (auto &player : game.players)
+    {
+      out.varint(player.id);
+      out.string(player.name);
+      out.string(player.strategy);
+      out.varint(player.reinforcementPool);
+      out.varint(player.hand.size());
+      for (int32_t cards : player.hand)
+      {
+        out.varint(cards);
+      }
+      out.signedVarint(player.territoriesLastTurn);
+    }
+    out.varint(game.armies.size());
+    for (size_t i = 0; i < game.armies.size(); i++)
+    {
+      out.signedVarint(game.owner[i]);
+      out.signedVarint(game.armies[i]);
+    }
+    out.varint(game.deck.size());
+    for (CardType card : game.deck)
+    {
+      out.byte((uint8_t)card);
+    }
+    out.varint(game.seed);
+    out.string(game.rng);
+  }
+
+  std::string tmpFile = fileName + ".tmp";
+  {
+    std::ofstream file(tmpFile, std::ios::out | std::ios::binary | std::ios::trunc);
+    file.write(out.bytes.data(), (std::streamsize)out.bytes.size());
+    file.flush();
+    if (!file)
+    {
+      throw std::runtime_error("TournamentCheckpoint::Error | Could not write " + tmpFile);
+    }
+  }
+  if (!replaceFile(tmpFile, fileName))
+  {
+    throw std::runtime_error("TournamentCheckpoint::Error | Could not move " + tmpFile + " to " + fileName);
+  }
+}
+
+/**
+ * @brief Reads a checkpoint file.
+ * @param fileName The checkpoint file.
+ * @return The checkpoint.
+ * @throws std::runtime_error if the file cannot be read or is not a valid checkpoint.
+ */
+TournamentCheckpoint TournamentCheckpoint::load(const std::string &fileName)
+{
+  std::vector<uint8_t> data = readBinaryFile(fileName, "TournamentCheckpoint");
+  if (data.size() < sizeof(MAGIC) + 1 || memcmp(data.data(), MAGIC, sizeof(MAGIC)) != 0)
+  {
+    throw std::runtime_error("TournamentCheckpoint::Error | " + fileName + " is not a checkpoint file");
+  }
+  BinaryReader in(data.data() + sizeof(MAGIC), data.data() + data.size(), "TournamentCheckpoint");
+  if (in.byte() != VERSION)
+  {
+    in.fail("Unsupported checkpoint version");
+  }
+
+  TournamentCheckpoint checkpoint;
+  checkpoint.maps = getStrings(in);
+  checkpoint.strategies = getStrings(in);
+  checkpoint.games = (int32_t)in.varint();
+  checkpoint.maxTurns = (int32_t)in.varint();
+
+  checkpoint.nextMap = (int32_t)in.varint();
+  checkpoint.nextGame = (int32_t)in.varint();
+  checkpoint.outputBytes = in.varint();
+  // A tally takes at least its name length and count bytes
+  uint64_t winners = in.count(2);
+  for (uint64_t i = 0; i < winners; i++)
+  {
+    std::string winner = in.string();
+    checkpoint.wins[winner] = (int32_t)in.varint();
+  }
+
+  checkpoint.hasGame = in.byte() != 0;
+  if (checkpoint.hasGame)
+  {
+    GameSnapshot &game = checkpoint.game;
+    checkpoint.gameMap = (int32_t)in.varint();
+    checkpoint.gameNumber = (int32_t)in.varint();
+    game.round = (int32_t)in.varint();
+    game.unchangedRounds = (int32_t)in.varint();
+    game.playerIds = (int32_t)in.varint();
+    // A player takes at least one byte per field
+    game.players.resize(in.count(6));
+    for (auto &player : game.players)
+    {
+      player.id = (int32_t)in.varint();
+      player.name = in.string();
+      player.strategy = in.string();
+      player.reinforcementPool = (int32_t)in.varint();
+      uint64_t cardTypes = in.count(1);
+      if (cardTypes > CARD_TYPE_COUNT)
+      {
+        in.fail("Too many card types");
+      }
+      player.hand.resize(cardTypes);
+      for (int32_t &cards : player.hand)
+      {
+        cards = (int32_t)in.varint();
+      }
+      player.territoriesLastTurn = in.signedVarint();
+      if (player.id >= game.playerIds)
+      {
+        in.fail("Player ID " + std::to_string(player.id) + " out of range");
+      }
+    }
+    // A territory takes at least its owner and armies bytes
+    uint64_t territories = in.count(2);
+    game.owner.reserve(territories);
+    game.armies.reserve(territories);
+    for (uint64_t i = 0; i < territories; i++)
+    {
+      game.owner.push_back(in.signedVarint());
+      game.armies.push_back(in.signedVarint());
+    }
+    game.deck.resize(in.count(1));
+    for (CardType &card : game.deck)
+    {
+      uint8_t type = in.byte();
+      if (type >= CARD_TYPE_COUNT)
+      {
+        in.fail("Unknown card type " + std::to_string(type));
+      }
+      card = (CardType)type;
+    }
+    game.seed = (uint32_t)in.varint();
+    game.rng = in.string();
+  }
+  if (!in.done())
+  {
+    in.fail("Unexpected data after the checkpoint");
+  }
+  return checkpoint;
+}
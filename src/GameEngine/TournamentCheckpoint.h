@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Cards.h includes the game engine, which includes this file
+enum CardType : int;
+
+/**
+ * @brief Everything needed to rebuild a player at the start of a round.
+ */
+struct PlayerSnapshot
+{
+  int32_t id = -1;
+  std::string name;
+  // Current strategy name, as given by PlayerStrategy::getName
+  std::string strategy;
+  int32_t reinforcementPool = 0;
+  // Cards in hand per card type
+  std::vector<int32_t> hand;
+  // Territories a Neutral player had on its last turn, or -1
+  int32_t territoriesLastTurn = -1;
+};
+
+/**
+ * @brief A game captured at the start of a round, before reinforcements.
+ *
+ * At that point every order list is empty, negotiations are over and eliminated players have been removed, so the
+ * game is fully described by the territories, the remaining players in turn order, the deck and the random number
+ * generator.
+ */
+struct GameSnapshot
+{
+  int32_t round = 0;
+  // Rounds in a row that ended with the same owners, for stalemate detection
+  int32_t unchangedRounds = 0;
+  // Number of player IDs handed out, including those of eliminated players
+  int32_t playerIds = 0;
+  // Remaining players, in turn order
+  std::vector<PlayerSnapshot> players;
+  // Armies and owner per territory ID
+  std::vector<int32_t> armies;
+  std::vector<int32_t> owner;
+  // Deck in draw order, the last card being drawn first
+  std::vector<CardType> deck;
+  // Seed the game started from
+  uint32_t seed = 0;
+  // State of the game's std::mt19937, in its text form
+  std::string rng;
+};
+
+/**
+ * @brief Progress of a free-for-all tournament: how far it got, the wins of the finished games and a snapshot of the
+ * game being played.
+ *
+ * Games are played in a fixed order, every game of the first map then every game of the next, so the finished games
+ * are those before a resume cursor. Their results are only kept as a tally per winner, and the results file they
+ * were streamed to is appended to on resume, so the checkpoint stays the same size however many games are played.
+ *
+ * The checkpoint is written to "<file>.tmp" and moved over the file, so a run killed while saving leaves the
+ * previous checkpoint intact. The tournament settings are stored with it, and a checkpoint is only resumed by the
+ * same tournament.
+ *
+ * File layout: "WZCP", a version byte, the maps, strategies, games and maximum turns, the cursor, the length of
+ * the results file, the wins, then a flag and the in-flight game. Integers are written with a BinaryWriter.
+ */
+struct TournamentCheckpoint
+{
+  static const char MAGIC[4];
+  static const uint8_t VERSION = 3;
+
+  // Tournament settings
+  std::vector<std::string> maps;
+  std::vector<std::string> strategies;
+  int32_t games = 0;
+  int32_t maxTurns = 0;
+
+  // Map and game index of the first game not finished
+  int32_t nextMap = 0;
+  int32_t nextGame = 0;
+  // Finished games won per player name, or "draw"
+  std::map<std::string, int32_t> wins;
+  // Length of the results file once the finished games were written to it, or 0 without one
+  uint64_t outputBytes = 0;
+
+  // Game being played, if a snapshot was taken since it started
+  bool hasGame = false;
+  int32_t gameMap = 0;
+  int32_t gameNumber = 0;
+  GameSnapshot game;
+
+  /**
+   * @brief Checks whether the checkpoint was written by a tournament with the same settings.
+   *
+   * @param other The checkpoint of the tournament to resume.
+   * @return True if the maps, strategies, number of games and maximum turns are the same.
+   */
+  bool sameTournament(const TournamentCheckpoint &other) const;
+
+  /**
+   * @brief Checks whether a game was finished before the checkpoint was taken.
+   *
+   * @param map The index of the map.
+   * @param game The index of the game on that map.
+   * @return True if the game comes before the resume cursor, false otherwise.
+   */
+  bool isFinished(int map, int game) const;
+
+  /**
+   * @brief Records a finished game: counts its winner, moves the resume cursor past it and drops the snapshot of the
+   * game being played.
+   *
+   * @param map The index of the map.
+   * @param game The index of the game on that map.
+   * @param winner The name of the winner, or "draw".
+   */
+  void addResult(int map, int game, const std::string &winner);
+
+  /**
+   * @brief Writes the checkpoint to a file, atomically.
+   *
+   * @param fileName The checkpoint file.
+   * @throws std::runtime_error if the file cannot be written.
+   */
+  void save(const std::string &fileName) const;
+
+  /**
+   * @brief Reads a checkpoint file.
+   *
+   * @param fileName The checkpoint file.
+   * @return The checkpoint.
+   * @throws std::runtime_error if the file cannot be read or is not a valid checkpoint.
+   */
+  static TournamentCheckpoint load(const std::string &fileName);
+};
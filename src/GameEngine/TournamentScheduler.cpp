@@ -0,0 +1,201 @@
+#include "TournamentScheduler.h"
+#include "GameEngine.h"
+#include "QuietConsole.h"
+#include "BinaryCodec.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <thread>
+
+/**
+ * @brief Constructor for TournamentScheduler.
+ * @param argc The number of command line arguments.
+ * @param argv The array of command line arguments.
+ * @param maxParallel The maximum number of tournaments run at once, or 0 to use one per hardware thread.
+ */
+TournamentScheduler::TournamentScheduler(int argc, char **argv, int maxParallel)
+    : maxParallel(maxParallel), argc(argc), argv(argv)
+{
+  if (this->maxParallel <= 0)
+  {
+    this->maxParallel = std::max(1, (int)std::thread::hardware_concurrency());
+  }
+}
+
+/**
+ * @brief Sets the limits every tournament is validated against.
+ * @param _limits The tournament limits.
+ */
+void TournamentScheduler::setLimits(const TournamentLimits &_limits)
+{
+  limits = _limits;
+}
+
+/**
+ * @brief Reads every tournament of a job file in a single pass.
+ * All invalid lines are reported together.
+ * @param jobFile The file listing the tournaments.
+ * @param outputPrefix The prefix of the output files.
+ * @throws std::runtime_error if the file cannot be read or any line is not a valid tournament command.
+ */
+void TournamentScheduler::loadJobs(const std::string &jobFile, const std::string &outputPrefix)
+{
+  std::ifstream input(jobFile);
+  if (!input.is_open())
+  {
+    throw std::runtime_error("TournamentScheduler::Error | Could not open " + jobFile);
+  }
+
+  std::string line;
+  std::string errors;
+  int lineNumber = 0;
+  while (std::getline(input, line))
+  {
+    lineNumber++;
+    size_t first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#')
+    {
+      continue;
+    }
+    try
+    {
+      addJob(line, outputPrefix + "." + std::to_string(lineNumber) + ".txt");
+      jobs.back().line = lineNumber;
+    }
+    catch (std::runtime_error &err)
+    {
+      errors += "\nline " + std::to_string(lineNumber) + ": " + err.what();
+    }
+  }
+
+  if (!errors.empty())
+  {
+    throw std::runtime_error("TournamentScheduler::Error | Invalid tournaments in " + jobFile + errors);
+  }
+}
+
+/**
+ * @brief Adds a tournament to run.
+ * @param command The tournament command.
+ * @param outputFile The file receiving its results table.
+ * @throws std::runtime_error if the command is not a valid tournament command.
+ */
+void TournamentScheduler::addJob(const std::string &command, const std::string &outputFile)
+{
+  TournamentJob job;
+  job.command = command;
+  job.parsed = CommandParser::parse(command);
+  job.outputFile = outputFile;
+
+  if (job.parsed.type != CMD_Tournament)
+  {
+    throw std::runtime_error("not a tournament command");
+  }
+  if (!job.parsed.isValid())
+  {
+    throw std::runtime_error(job.parsed.describeError());
+  }
+  jobs.push_back(job);
+}
+
+/**
+ * @brief Gets the jobs to run, in order.
+ * @return The jobs.
+ */
+const std::vector<TournamentJob> &TournamentScheduler::getJobs() const
+{
+  return jobs;
+}
+
+/**
+ * @brief Checks whether the output of a job already holds its results.
+ * Outputs only ever appear complete, so it is enough to check that the file is there and was made for this command.
+ * @param job The job to check.
+ * @return True if the job was completed by an earlier run, false otherwise.
+ */
+bool TournamentScheduler::isComplete(const TournamentJob &job)
+{
+  std::ifstream output(job.outputFile);
+  std::string header;
+  return output.is_open() && std::getline(output, header) && header == "# " + job.command;
+}
+
+/**
+ * @brief Runs a single job on a fresh game engine and writes its results.
+ * The table is first written to "<outputFile>.tmp" and then moved over the output.
+ * @param job The job to run.
+ * @return The outcome of the job.
+ */
+TournamentJobResult TournamentScheduler::runJob(const TournamentJob &job) const
+{
+  TournamentJobResult result;
+  try
+  {
+    GameEngine engine(argc, argv);
+    engine.parallelRun = true;
+    engine.configureTournament(job.parsed);
+    engine.tournamentLimits = limits;
+    engine.validateTournament();
+    engine.setCurrentState(GE_Tournament);
+    engine.runTournament();
+
+    std::string tmpFile = job.outputFile + ".tmp";
+    std::ofstream output(tmpFile, std::ios::out | std::ios::trunc);
+    output << "# " << job.command << '\n'
+           << engine.getTournamentResults();
+    output.close();
+    if (!output)
+    {
+      throw std::runtime_error("could not write " + tmpFile);
+    }
+    if (!replaceFile(tmpFile, job.outputFile))
+    {
+      throw std::runtime_error("could not move " + tmpFile + " to " + job.outputFile);
+    }
+    result.succeeded = true;
+  }
+  catch (std::runtime_error &err)
+  {
+    result.error = err.what();
+  }
+  return result;
+}
+
+/**
+ * @brief Runs every job that is not complete yet on a bounded pool of worker threads.
+ * Workers pull the next job index from a shared counter, so a long tournament never holds up the others.
+ * @return The outcome of every job, in job order.
+ */
+std::vector<TournamentJobResult> TournamentScheduler::run() const
+{
+  std::vector<TournamentJobResult> results(jobs.size());
+  std::atomic<size_t> next(0);
+
+  auto worker = [&]()
+  {
+    for (size_t i = next++; i < jobs.size(); i = next++)
+    {
+      if (isComplete(jobs[i]))
+      {
+        results[i].skipped = true;
+        results[i].succeeded = true;
+        continue;
+      }
+      results[i] = runJob(jobs[i]);
+    }
+  };
+
+  QuietConsole quiet;
+  int threadCount = std::min(maxParallel, (int)jobs.size());
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threadCount; t++)
+  {
+    pool.emplace_back(worker);
+  }
+  for (auto &thread : pool)
+  {
+    thread.join();
+  }
+  return results;
+}
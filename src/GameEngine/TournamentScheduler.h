@@ -0,0 +1,114 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "Command/CommandParser.h"
+#include "GameEngine.h"
+
+/**
+ * @brief One tournament of a job file and where its results table goes.
+ */
+struct TournamentJob
+{
+  int line = 0;
+  std::string command;
+  ParsedCommand parsed;
+  std::string outputFile;
+};
+
+/**
+ * @brief Outcome of running one tournament job.
+ */
+struct TournamentJobResult
+{
+  // The output already held this job's results, so it was not run again
+  bool skipped = false;
+  bool succeeded = false;
+  std::string error;
+};
+
+/**
+ * @brief Runs the tournaments of a job file concurrently, each one on its own GameEngine.
+ *
+ * Every tournament line is parsed once into an independent job. Jobs are handed to at most maxParallel worker
+ * threads, and each job writes its results table to its own output file. The file is written under a temporary
+ * name and moved over the output once complete, so a killed run never leaves a partial table behind; running the same job file
+ * again skips every job whose output already holds its results.
+ */
+class TournamentScheduler
+{
+private:
+  std::vector<TournamentJob> jobs;
+  int maxParallel;
+  TournamentLimits limits;
+
+  // Passed on to every GameEngine
+  int argc;
+  char **argv;
+
+  /**
+   * @brief Runs a single job on a fresh game engine and writes its results.
+   *
+   * @param job The job to run.
+   * @return The outcome of the job.
+   */
+  TournamentJobResult runJob(const TournamentJob &job) const;
+
+public:
+  /**
+   * @brief Constructor for TournamentScheduler.
+   *
+   * @param argc The number of command line arguments.
+   * @param argv The array of command line arguments.
+   * @param maxParallel The maximum number of tournaments run at once, or 0 to use one per hardware thread.
+   */
+  TournamentScheduler(int argc, char **argv, int maxParallel = 0);
+
+  /**
+   * @brief Sets the limits every tournament is validated against. The default is the assignment limits.
+   *
+   * @param limits The tournament limits.
+   */
+  void setLimits(const TournamentLimits &limits);
+
+  /**
+   * @brief Reads every tournament of a job file, one per line. Blank lines and lines starting with '#' are ignored.
+   * The results of line N go to "<outputPrefix>.N.txt".
+   *
+   * @param jobFile The file listing the tournaments.
+   * @param outputPrefix The prefix of the output files.
+   * @throws std::runtime_error if the file cannot be read or any line is not a valid tournament command.
+   */
+  void loadJobs(const std::string &jobFile, const std::string &outputPrefix);
+
+  /**
+   * @brief Adds a tournament to run.
+   *
+   * @param command The tournament command.
+   * @param outputFile The file receiving its results table.
+   * @throws std::runtime_error if the command is not a valid tournament command.
+   */
+  void addJob(const std::string &command, const std::string &outputFile);
+
+  /**
+   * @brief Gets the jobs to run, in order.
+   *
+   * @return The jobs.
+   */
+  const std::vector<TournamentJob> &getJobs() const;
+
+  /**
+   * @brief Checks whether the output of a job already holds its results.
+   *
+   * @param job The job to check.
+   * @return True if the job was completed by an earlier run, false otherwise.
+   */
+  static bool isComplete(const TournamentJob &job);
+
+  /**
+   * @brief Runs every job that is not complete yet. The console is silenced while the jobs run.
+   *
+   * @return The outcome of every job, in job order.
+   */
+  std::vector<TournamentJobResult> run() const;
+};
@@ -1,4 +1,5 @@
 #include "LogObserver.h"
+#include "GameEngine/GameEngine.h"
 
 // -----------------------------------------------------------------------------------------------------------------
 //
@@ -87,10 +88,15 @@ LogObserver::LogObserver(LogObserver *observer)
 
 /**
  * @brief Updates the LogObserver with information from a loggable entity.
+ * Engines of a parallel run do not log, so they never contend for the shared log file.
  * @param loggable The loggable entity.
  */
 void LogObserver::update(ILoggable *loggable)
 {
+  if (game->parallelRun)
+  {
+    return;
+  }
   std::fstream file;
   try
   {
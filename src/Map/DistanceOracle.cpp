@@ -0,0 +1,323 @@
+#include "DistanceOracle.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+const uint16_t DistanceOracle::UNREACHABLE;
+const int DistanceOracle::FULL_TABLE_LIMIT;
+const int DistanceOracle::DEFAULT_CACHE_ROWS;
+
+/**
+ * @brief Gets the number of hops from a territory to the nearest territory of the set.
+ *
+ * @param id The ID of the territory.
+ * @return The number of hops, or -1 if no territory of the set can be reached.
+ */
+int DistanceField::distance(int id) const
+{
+  return distances[id] == DistanceOracle::UNREACHABLE ? -1 : distances[id];
+}
+
+/**
+ * @brief Gets the first step from a territory toward the nearest territory of the set.
+ *
+ * @param id The ID of the territory.
+ * @return The ID of the adjacent territory to move to, id itself if it is in the set, or -1 if unreachable.
+ */
+int DistanceField::nextHop(int id) const
+{
+  return nextHops[id];
+}
+
+/**
+ * @brief Copy constructor. The LRU cache is not copied.
+ *
+ * @param other The oracle to copy.
+ */
+DistanceOracle::DistanceOracle(const DistanceOracle &other)
+    : adjacencyStart(other.adjacencyStart), adjacency(other.adjacency), reverseStart(other.reverseStart),
+      reverse(other.reverse), distances(other.distances), nextHops(other.nextHops), fullTables(other.fullTables),
+      cacheRows(other.cacheRows)
+{
+}
+
+/**
+ * @brief Assignment operator. The LRU cache is emptied.
+ *
+ * @param other The oracle to copy.
+ * @return This oracle.
+ */
+DistanceOracle &DistanceOracle::operator=(const DistanceOracle &other)
+{
+  if (this != &other)
+  {
+    clear();
+    adjacencyStart = other.adjacencyStart;
+    adjacency = other.adjacency;
+    reverseStart = other.reverseStart;
+    reverse = other.reverse;
+    distances = other.distances;
+    nextHops = other.nextHops;
+    fullTables = other.fullTables;
+    cacheRows = other.cacheRows;
+  }
+  return *this;
+}
+
+/**
+ * @brief Builds the oracle from an adjacency in compressed sparse row form.
+ * With full tables, one BFS per territory is run; territories are handed out to the threads through a shared counter
+ * and every thread writes its own rows.
+ *
+ * @param start The offset of the neighbours of each territory in neighbours, followed by the total count.
+ * @param neighbours The IDs of the neighbours of every territory, territory by territory.
+ * @param threads The number of BFS threads, or 0 to use one per hardware thread.
+ * @param fullTableLimit The largest number of territories for which full tables are built.
+ * @param cacheSize The number of rows kept in the LRU cache when full tables are not built.
+ */
+void DistanceOracle::build(const std::vector<int32_t> &start, const std::vector<int32_t> &neighbours, int threads,
+                           int fullTableLimit, int cacheSize)
+{
+  clear();
+  adjacencyStart = start;
+  adjacency = neighbours;
+  int n = size();
+
+  // Reverse adjacency, so a BFS from a target walks the edges that lead to it
+  reverseStart.assign(n + 1, 0);
+  for (int32_t to : adjacency)
+  {
+    reverseStart[to + 1]++;
+  }
+  for (int v = 0; v < n; v++)
+  {
+    reverseStart[v + 1] += reverseStart[v];
+  }
+  reverse.resize(adjacency.size());
+  std::vector<int32_t> fill(reverseStart.begin(), reverseStart.end() - 1);
+  for (int from = 0; from < n; from++)
+  {
+    for (int i = adjacencyStart[from]; i < adjacencyStart[from + 1]; i++)
+    {
+      reverse[fill[adjacency[i]]++] = from;
+    }
+  }
+
+  cacheRows = std::max(cacheSize, 1);
+  fullTables = n <= fullTableLimit;
+  if (!fullTables)
+  {
+    return;
+  }
+
+  distances.assign((size_t)n * n, UNREACHABLE);
+  nextHops.assign((size_t)n * n, UNREACHABLE);
+  if (threads <= 0)
+  {
+    threads = std::max(1, (int)std::thread::hardware_concurrency());
+  }
+  // Spawning threads costs more than the BFS of a small map
+  threads = std::min(threads, std::max(1, n / 64));
+
+  std::atomic<int> next(0);
+  auto worker = [&]()
+  {
+    DistanceField field;
+    std::vector<int32_t> queue;
+    std::vector<int> target(1);
+    for (int to = next++; to < n; to = next++)
+    {
+      target[0] = to;
+      reverseBfs(target, field, queue);
+      uint16_t *rowDistances = &distances[(size_t)to * n];
+      uint16_t *rowNextHops = &nextHops[(size_t)to * n];
+      for (int from = 0; from < n; from++)
+      {
+        rowDistances[from] = field.distances[from];
+        rowNextHops[from] = field.nextHops[from] < 0 ? UNREACHABLE : (uint16_t)field.nextHops[from];
+      }
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (int t = 1; t < threads; t++)
+  {
+    pool.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : pool)
+  {
+    thread.join();
+  }
+}
+
+/**
+ * @brief Empties the oracle.
+ */
+void DistanceOracle::clear()
+{
+  adjacencyStart.clear();
+  adjacency.clear();
+  reverseStart.clear();
+  reverse.clear();
+  distances.clear();
+  nextHops.clear();
+  fullTables = false;
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  recentTargets.clear();
+  cache.clear();
+}
+
+/**
+ * @brief Gets the number of territories covered.
+ *
+ * @return The number of territories.
+ */
+int DistanceOracle::size() const
+{
+  return adjacencyStart.empty() ? 0 : (int)adjacencyStart.size() - 1;
+}
+
+/**
+ * @brief Checks whether every pair is answered from the precomputed tables.
+ *
+ * @return True if full tables were built, false if rows are computed on demand.
+ */
+bool DistanceOracle::hasFullTables() const
+{
+  return fullTables;
+}
+
+/**
+ * @brief Runs a BFS backward from the given targets.
+ * A territory's next hop is the territory it was discovered from, which is one hop closer to a target.
+ *
+ * @param targets The IDs of the targets.
+ * @param field Receives the distance and next hop of every territory.
+ * @param queue Scratch buffer for the BFS queue.
+ */
+void DistanceOracle::reverseBfs(const std::vector<int> &targets, DistanceField &field, std::vector<int32_t> &queue) const
+{
+  int n = size();
+  field.distances.assign(n, UNREACHABLE);
+  field.nextHops.assign(n, -1);
+  queue.clear();
+  for (int target : targets)
+  {
+    field.distances[target] = 0;
+    field.nextHops[target] = target;
+    queue.push_back(target);
+  }
+
+  for (size_t head = 0; head < queue.size(); head++)
+  {
+    int32_t to = queue[head];
+    // Paths longer than UNREACHABLE - 1 hops are clamped
+    uint16_t distance = (uint16_t)std::min<int>(field.distances[to] + 1, UNREACHABLE - 1);
+    for (int i = reverseStart[to]; i < reverseStart[to + 1]; i++)
+    {
+      int32_t from = reverse[i];
+      if (field.distances[from] == UNREACHABLE)
+      {
+        field.distances[from] = distance;
+        field.nextHops[from] = to;
+        queue.push_back(from);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Gets the row of a target from the cache, computing it on a miss and evicting the least recently used row
+ * when the cache is full.
+ *
+ * @param to The ID of the target.
+ * @param from The ID of the territory asking.
+ * @param distance Receives the distance, or -1.
+ * @param nextHop Receives the next hop, or -1.
+ */
+void DistanceOracle::cachedLookup(int to, int from, int &distance, int &nextHop) const
+{
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  auto entry = cache.find(to);
+  if (entry != cache.end())
+  {
+    recentTargets.splice(recentTargets.begin(), recentTargets, entry->second.second);
+  }
+  else
+  {
+    if (cache.size() >= cacheRows)
+    {
+      cache.erase(recentTargets.back());
+      recentTargets.pop_back();
+    }
+    recentTargets.push_front(to);
+    entry = cache.emplace(to, std::make_pair(DistanceField(), recentTargets.begin())).first;
+    std::vector<int32_t> queue;
+    reverseBfs(std::vector<int>(1, to), entry->second.first, queue);
+  }
+  distance = entry->second.first.distance(from);
+  nextHop = entry->second.first.nextHop(from);
+}
+
+/**
+ * @brief Gets the number of hops from one territory to another.
+ *
+ * @param from The ID of the starting territory.
+ * @param to The ID of the target territory.
+ * @return The number of hops, or -1 if the target cannot be reached.
+ */
+int DistanceOracle::distance(int from, int to) const
+{
+  if (fullTables)
+  {
+    uint16_t distance = distances[(size_t)to * size() + from];
+    return distance == UNREACHABLE ? -1 : distance;
+  }
+  int distance, nextHop;
+  cachedLookup(to, from, distance, nextHop);
+  return distance;
+}
+
+/**
+ * @brief Gets the first step on a shortest path from one territory to another.
+ *
+ * @param from The ID of the starting territory.
+ * @param to The ID of the target territory.
+ * @return The ID of the adjacent territory to move to, from itself if from == to, or -1 if the target cannot be reached.
+ */
+int DistanceOracle::nextHop(int from, int to) const
+{
+  if (fullTables)
+  {
+    uint16_t nextHop = nextHops[(size_t)to * size() + from];
+    return nextHop == UNREACHABLE ? -1 : nextHop;
+  }
+  int distance, nextHop;
+  cachedLookup(to, from, distance, nextHop);
+  return nextHop;
+}
+
+/**
+ * @brief Computes the distance and next hop from every territory toward the nearest territory of a set,
+ * with a single multi-source BFS.
+ *
+ * @param targets The target territories, e.g. every enemy territory.
+ * @return The field, answering "next step toward the nearest target" in O(1) for any territory.
+ */
+DistanceField DistanceOracle::towards(const TerritorySet &targets) const
+{
+  std::vector<int> ids;
+  int n = size();
+  targets.forEach([&](int id)
+                  {
+    if (id < n)
+    {
+      ids.push_back(id);
+    } });
+  DistanceField field;
+  std::vector<int32_t> queue;
+  reverseBfs(ids, field, queue);
+  return field;
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Map/TerritorySet.h"
+
+/**
+ * @brief Hop distances and next hops from every territory to a set of territories, from one multi-source BFS.
+ */
+struct DistanceField
+{
+  std::vector<uint16_t> distances;
+  std::vector<int32_t> nextHops;
+
+  /**
+   * @brief Gets the number of hops from a territory to the nearest territory of the set.
+   *
+   * @param id The ID of the territory.
+   * @return The number of hops, or -1 if no territory of the set can be reached.
+   */
+  int distance(int id) const;
+
+  /**
+   * @brief Gets the first step from a territory toward the nearest territory of the set.
+   *
+   * @param id The ID of the territory.
+   * @return The ID of the adjacent territory to move to, id itself if it is in the set, or -1 if unreachable.
+   */
+  int nextHop(int id) const;
+};
+
+/**
+ * @brief All-pairs hop distance and next-hop oracle over the adjacency of a map.
+ *
+ * Up to fullTableLimit territories, a BFS is run from every territory when the oracle is built, spread over worker
+ * threads, and the results are kept as two N x N tables of uint16 (distance, next hop), so every query is a
+ * table lookup. Larger maps would need too much memory for that: rows are then computed by BFS on demand and the
+ * most recently used ones are kept in an LRU cache.
+ *
+ * Adjacency may be one-way: distances follow the direction of the edges, from the asking territory to the target.
+ */
+class DistanceOracle
+{
+private:
+  // Adjacency in compressed sparse row form, and its reverse
+  std::vector<int32_t> adjacencyStart;
+  std::vector<int32_t> adjacency;
+  std::vector<int32_t> reverseStart;
+  std::vector<int32_t> reverse;
+
+  // Full tables, row per target: distances[to * N + from], nextHops[to * N + from]
+  std::vector<uint16_t> distances;
+  std::vector<uint16_t> nextHops;
+  bool fullTables = false;
+
+  // On-demand rows for large maps, most recently used first
+  size_t cacheRows = 0;
+  mutable std::mutex cacheMutex;
+  mutable std::list<int> recentTargets;
+  mutable std::unordered_map<int, std::pair<DistanceField, std::list<int>::iterator>> cache;
+
+  /**
+   * @brief Runs a BFS backward from the given targets.
+   *
+   * @param targets The IDs of the targets.
+   * @param field Receives the distance and next hop of every territory.
+   * @param queue Scratch buffer for the BFS queue.
+   */
+  void reverseBfs(const std::vector<int> &targets, DistanceField &field, std::vector<int32_t> &queue) const;
+
+  /**
+   * @brief Gets the row of a target from the cache, computing it on a miss.
+   *
+   * @param to The ID of the target.
+   * @param from The ID of the territory asking.
+   * @param distance Receives the distance, or -1.
+   * @param nextHop Receives the next hop, or -1.
+   */
+  void cachedLookup(int to, int from, int &distance, int &nextHop) const;
+
+public:
+  // Distance stored for territories that cannot reach the target
+  static const uint16_t UNREACHABLE = 0xFFFF;
+
+  // Largest map for which full tables are built (2 x 2048 x 2048 x 2 bytes = 16 MB)
+  static const int FULL_TABLE_LIMIT = 2048;
+
+  // Rows kept in the LRU cache of large maps
+  static const int DEFAULT_CACHE_ROWS = 256;
+
+  DistanceOracle() = default;
+  DistanceOracle(const DistanceOracle &other);
+  DistanceOracle &operator=(const DistanceOracle &other);
+
+  /**
+   * @brief Builds the oracle from an adjacency in compressed sparse row form.
+   *
+   * @param start The offset of the neighbours of each territory in neighbours, followed by the total count.
+   * @param neighbours The IDs of the neighbours of every territory, territory by territory.
+   * @param threads The number of BFS threads, or 0 to use one per hardware thread.
+   * @param fullTableLimit The largest number of territories for which full tables are built.
+   * @param cacheSize The number of rows kept in the LRU cache when full tables are not built.
+   */
+  void build(const std::vector<int32_t> &start, const std::vector<int32_t> &neighbours, int threads = 0,
+             int fullTableLimit = FULL_TABLE_LIMIT, int cacheSize = DEFAULT_CACHE_ROWS);
+
+  /**
+   * @brief Empties the oracle.
+   */
+  void clear();
+
+  /**
+   * @brief Gets the number of territories covered.
+   *
+   * @return The number of territories.
+   */
+  int size() const;
+
+  /**
+   * @brief Checks whether every pair is answered from the precomputed tables.
+   *
+   * @return True if full tables were built, false if rows are computed on demand.
+   */
+  bool hasFullTables() const;
+
+  /**
+   * @brief Gets the number of hops from one territory to another.
+   *
+   * @param from The ID of the starting territory.
+   * @param to The ID of the target territory.
+   * @return The number of hops, or -1 if the target cannot be reached.
+   */
+  int distance(int from, int to) const;
+
+  /**
+   * @brief Gets the first step on a shortest path from one territory to another.
+   *
+   * @param from The ID of the starting territory.
+   * @param to The ID of the target territory.
+   * @return The ID of the adjacent territory to move to, from itself if from == to, or -1 if the target cannot be reached.
+   */
+  int nextHop(int from, int to) const;
+
+  /**
+   * @brief Computes the distance and next hop from every territory toward the nearest territory of a set.
+   *
+   * @param targets The target territories, e.g. every enemy territory.
+   * @return The field, answering "next step toward the nearest target" in O(1) for any territory.
+   */
+  DistanceField towards(const TerritorySet &targets) const;
+};
@@ -0,0 +1,111 @@
+#include "EdgeIndex.h"
+#include "TerritoryStore.h"
+
+const uint64_t EdgeIndex::EMPTY;
+
+/**
+ * @brief Packs an edge into a key. Territory IDs are never negative, so a key is never EMPTY.
+ *
+ * @param from The ID of the source territory.
+ * @param to The ID of the target territory.
+ * @return The key.
+ */
+uint64_t EdgeIndex::key(int from, int to)
+{
+  return ((uint64_t)(uint32_t)from << 32) | (uint32_t)to;
+}
+
+/**
+ * @brief Builds the index from an adjacency in compressed sparse row form. Duplicate edges are stored once.
+ *
+ * @param start The offset of the neighbours of each territory in neighbours, followed by the total count.
+ * @param neighbours The IDs of the neighbours of every territory, territory by territory.
+ */
+void EdgeIndex::build(const std::vector<int32_t> &start, const std::vector<int32_t> &neighbours)
+{
+  territories = start.empty() ? 0 : (int)start.size() - 1;
+  edges = 0;
+
+  size_t capacity = 16;
+  while (capacity < neighbours.size() * 2)
+  {
+    capacity *= 2;
+  }
+  slots.assign(capacity, EMPTY);
+  mask = capacity - 1;
+
+  for (int from = 0; from < territories; from++)
+  {
+    for (int i = start[from]; i < start[from + 1]; i++)
+    {
+      uint64_t edge = key(from, neighbours[i]);
+      uint64_t slot = TerritoryStore::mixKey(edge) & mask;
+      while (slots[slot] != EMPTY && slots[slot] != edge)
+      {
+        slot = (slot + 1) & mask;
+      }
+      if (slots[slot] == EMPTY)
+      {
+        slots[slot] = edge;
+        edges++;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Empties the index.
+ */
+void EdgeIndex::clear()
+{
+  slots.clear();
+  mask = 0;
+  territories = 0;
+  edges = 0;
+}
+
+/**
+ * @brief Gets the number of territories the index was built for.
+ *
+ * @return The number of territories.
+ */
+int EdgeIndex::size() const
+{
+  return territories;
+}
+
+/**
+ * @brief Gets the number of distinct edges in the index.
+ *
+ * @return The number of edges.
+ */
+int EdgeIndex::edgeCount() const
+{
+  return edges;
+}
+
+/**
+ * @brief Checks whether an edge exists.
+ *
+ * @param from The ID of the source territory.
+ * @param to The ID of the target territory.
+ * @return True if to is in the adjacency list of from, false otherwise.
+ */
+bool EdgeIndex::contains(int from, int to) const
+{
+  if (slots.empty() || from < 0 || to < 0)
+  {
+    return false;
+  }
+  uint64_t edge = key(from, to);
+  uint64_t slot = TerritoryStore::mixKey(edge) & mask;
+  while (slots[slot] != EMPTY)
+  {
+    if (slots[slot] == edge)
+    {
+      return true;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return false;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Set of the directed edges of a map, answering "is B adjacent to A" in constant time.
+ *
+ * Edges are keyed by (from, to) territory IDs packed into 64 bits and stored in an open-addressing hash table
+ * with linear probing, kept at most half full so a lookup probes one or two slots on average whatever the degree
+ * of the territories involved.
+ */
+class EdgeIndex
+{
+private:
+  // Packed (from, to) keys, EMPTY for free slots; the size is a power of two
+  std::vector<uint64_t> slots;
+  uint64_t mask = 0;
+  int territories = 0;
+  int edges = 0;
+
+  static const uint64_t EMPTY = ~0ULL;
+
+  /**
+   * @brief Packs an edge into a key.
+   *
+   * @param from The ID of the source territory.
+   * @param to The ID of the target territory.
+   * @return The key.
+   */
+  static uint64_t key(int from, int to);
+
+public:
+  /**
+   * @brief Builds the index from an adjacency in compressed sparse row form.
+   *
+   * @param start The offset of the neighbours of each territory in neighbours, followed by the total count.
+   * @param neighbours The IDs of the neighbours of every territory, territory by territory.
+   */
+  void build(const std::vector<int32_t> &start, const std::vector<int32_t> &neighbours);
+
+  /**
+   * @brief Empties the index.
+   */
+  void clear();
+
+  /**
+   * @brief Gets the number of territories the index was built for.
+   *
+   * @return The number of territories.
+   */
+  int size() const;
+
+  /**
+   * @brief Gets the number of distinct edges in the index.
+   *
+   * @return The number of edges.
+   */
+  int edgeCount() const;
+
+  /**
+   * @brief Checks whether an edge exists.
+   *
+   * @param from The ID of the source territory.
+   * @param to The ID of the target territory.
+   * @return True if to is in the adjacency list of from, false otherwise.
+   */
+  bool contains(int from, int to) const;
+};
@@ -20,19 +20,40 @@ bool Map::validate()
 /**
  * @brief Performs Depth-First Search (DFS) on the given territory to check if it is strongly connected.
  *
+ * Visited territories are tracked by their dense ID, so each lookup is a single array access.
+ * Territories that were referenced as neighbours but never declared have no ID and count as unvisitable.
+ *
  * @param territory The starting territory for DFS.
- * @param visited Vector to store visited territories during DFS.
+ * @param visited Flags indexed by territory ID, set for every territory reached.
+ * @return The number of territories reached, or -1 if an undeclared territory was reached.
  */
-void Map::DFS(Territory *territory, std::vector<Territory *> &visited)
+int Map::DFS(Territory *territory, std::vector<char> &visited)
 {
-  visited.push_back(territory);
-  for (auto adjacent : *territory->getAdjacentTerritories())
+  int reached = 0;
+  std::vector<Territory *> stack{territory};
+  visited[territory->getId()] = 1;
+
+  while (!stack.empty())
   {
-    if (std::find(visited.begin(), visited.end(), adjacent) == visited.end())
+    Territory *current = stack.back();
+    stack.pop_back();
+    reached++;
+
+    for (auto adjacent : *current->getAdjacentTerritories())
     {
-      DFS(adjacent, visited);
+      int adjacentId = adjacent->getId();
+      if (adjacentId == -1)
+      {
+        return -1;
+      }
+      if (!visited[adjacentId])
+      {
+        visited[adjacentId] = 1;
+        stack.push_back(adjacent);
+      }
     }
   }
+  return reached;
 }
 
 /**
@@ -43,9 +64,8 @@ void Map::DFS(Territory *territory, std::vector<Territory *> &visited)
  */
 bool Map::isTerritoryStronglyConnected(Territory *territory)
 {
-  std::vector<Territory *> visited{};
-  DFS(territory, visited);
-  return visited.size() == territories.size();
+  std::vector<char> visited(territories.size(), 0);
+  return DFS(territory, visited) == (int)territories.size();
 }
 
 /**
@@ -70,6 +90,50 @@ bool Map::isTerritories1to1Continents()
                      { return !c->getTerritories()->empty(); });
 }
 
+/**
+ * @brief Creates a continent in the arena of the map. The continent still has to be added to the map.
+ *
+ * @param name The symbol of the name of the continent, in the symbol table of the map.
+ * @param bonus The bonus of the continent.
+ * @return The continent, owned by the map.
+ */
+Continent *Map::createContinent(uint32_t name, int bonus)
+{
+  return arena.create<Continent>(arena, symbols, name, bonus);
+}
+
+/**
+ * @brief Creates a territory in the arena of the map. The territory still has to be added to the map; one that
+ * never is, e.g. referenced as adjacent but never declared, is released with the map all the same.
+ *
+ * @param name The symbol of the name of the territory, in the symbol table of the map.
+ * @return The territory, owned by the map.
+ */
+Territory *Map::createTerritory(uint32_t name)
+{
+  return arena.create<Territory>(arena, symbols, name);
+}
+
+/**
+ * @brief Gets the arena holding the territories and continents of the map.
+ *
+ * @return The arena.
+ */
+const MapArena &Map::getArena() const
+{
+  return arena;
+}
+
+/**
+ * @brief Gets the symbol table holding the names of the territories and continents of the map.
+ *
+ * @return The symbol table.
+ */
+SymbolTable *Map::getSymbols()
+{
+  return &symbols;
+}
+
 /**
  * @brief Adds a continent to the map.
  *
@@ -77,6 +141,7 @@ bool Map::isTerritories1to1Continents()
  */
 void Map::addContinent(Continent *continent)
 {
+  continent->setId((int)this->continents.size());
   this->continents.push_back(continent);
 }
 
@@ -87,7 +152,231 @@ void Map::addContinent(Continent *continent)
  */
 void Map::addTerritory(Territory *territory)
 {
+  Player *owner = territory->getPlayer();
+  Continent *continent = territory->getContinent();
+  int ownerId = owner ? owner->getId() : TerritoryStore::NEUTRAL;
+  int id = store.add(territory->getArmies(), ownerId, continent ? continent->getId() : -1);
+  territory->attach(this, id);
   this->territories.push_back(territory);
+  if (ownerId != TerritoryStore::NEUTRAL && isGameMap())
+  {
+    game->onTerritoryOwnerChanged(TerritoryStore::NEUTRAL, ownerId);
+  }
+}
+
+/**
+ * @brief Changes the owner of a territory and notifies the game engine.
+ *
+ * @param id The ID of the territory.
+ * @param player The new owner, or nullptr for neutral.
+ */
+void Map::setOwner(int id, Player *player)
+{
+  int oldOwnerId = store.owner[id];
+  int newOwnerId = player ? player->getId() : TerritoryStore::NEUTRAL;
+  if (oldOwnerId == newOwnerId)
+  {
+    return;
+  }
+  store.setOwner(id, newOwnerId);
+  if (isGameMap())
+  {
+    game->onTerritoryOwnerChanged(oldOwnerId, newOwnerId);
+  }
+}
+
+/**
+ * @brief Checks whether this map is the one being played by its game engine.
+ *        Ownership changes on clones must not affect the engine's win and elimination tracking.
+ *
+ * @return True if the game engine plays on this map, false otherwise.
+ */
+bool Map::isGameMap()
+{
+  return game->getMap() == this;
+}
+
+/**
+ * @brief Gets the hot state of every territory in the map.
+ *
+ * @return Pointer to the territory store.
+ */
+TerritoryStore *Map::getStore()
+{
+  return &this->store;
+}
+
+/**
+ * @brief Resolves an owner ID from the territory store to its player.
+ *
+ * @param ownerId The ID of the player, or TerritoryStore::NEUTRAL.
+ * @return Pointer to the player, or nullptr for neutral territories.
+ */
+Player *Map::getOwner(int ownerId)
+{
+  if (ownerId == TerritoryStore::NEUTRAL)
+  {
+    return nullptr;
+  }
+  return game->getPlayerById(ownerId);
+}
+
+/**
+ * @brief Gets a territory by its dense ID.
+ *
+ * @param id The ID of the territory (0..N-1).
+ * @return Pointer to the territory.
+ */
+Territory *Map::getTerritoryById(int id)
+{
+  return this->territories.at(id);
+}
+
+/**
+ * @brief Builds the neighbour bitset of every territory from the adjacency lists.
+ */
+void Map::buildNeighbourSets()
+{
+  int size = (int)territories.size();
+  neighbourSets.assign(size, TerritorySet(size));
+  for (auto territory : territories)
+  {
+    auto &neighbours = neighbourSets[territory->getId()];
+    for (auto adjacent : *territory->getAdjacentTerritories())
+    {
+      neighbours.set(adjacent->getId());
+    }
+  }
+}
+
+/**
+ * @brief Gets the set of territories adjacent to a territory.
+ *
+ * @param id The ID of the territory.
+ * @return Bitset of the IDs of the adjacent territories.
+ */
+const TerritorySet &Map::getNeighbourSet(int id)
+{
+  if (neighbourSets.size() != territories.size())
+  {
+    buildNeighbourSets();
+  }
+  return neighbourSets.at(id);
+}
+
+/**
+ * @brief Builds the distance oracle from the adjacency lists.
+ * Adjacency to territories that are not part of the map is ignored.
+ */
+void Map::buildDistanceOracle()
+{
+  std::vector<int32_t> start, neighbours;
+  buildAdjacency(start, neighbours);
+  distanceOracle.build(start, neighbours);
+}
+
+/**
+ * @brief Collects the adjacency lists in compressed sparse row form.
+ * Adjacency to territories that are not part of the map is ignored.
+ *
+ * @param start Receives the offset of the neighbours of each territory, followed by the total count.
+ * @param neighbours Receives the IDs of the neighbours of every territory, territory by territory.
+ */
+void Map::buildAdjacency(std::vector<int32_t> &start, std::vector<int32_t> &neighbours)
+{
+  int size = (int)territories.size();
+  start.assign(1, 0);
+  neighbours.clear();
+  start.reserve(size + 1);
+  for (auto territory : territories)
+  {
+    for (auto adjacent : *territory->getAdjacentTerritories())
+    {
+      int adjacentId = adjacent->getId();
+      if (adjacentId >= 0 && adjacentId < size && territories[adjacentId] == adjacent)
+      {
+        neighbours.push_back(adjacentId);
+      }
+    }
+    start.push_back((int32_t)neighbours.size());
+  }
+}
+
+/**
+ * @brief Builds the edge index from the adjacency lists.
+ * Adjacency to territories that are not part of the map is ignored.
+ */
+void Map::buildEdgeIndex()
+{
+  std::vector<int32_t> start, neighbours;
+  buildAdjacency(start, neighbours);
+  edgeIndex.build(start, neighbours);
+}
+
+/**
+ * @brief Drops everything built from the adjacency lists after one of them changed: the edge index, the distance
+ * oracle and the neighbour bitsets. The next query rebuilds them.
+ */
+void Map::invalidateAdjacency()
+{
+  edgeIndex.clear();
+  distanceOracle.clear();
+  neighbourSets.clear();
+}
+
+/**
+ * @brief Checks whether a territory is in the adjacency list of another, in constant time.
+ *
+ * @param from The ID of the territory whose adjacency list is checked.
+ * @param to The ID of the territory looked for.
+ * @return True if the territories are adjacent, false otherwise.
+ */
+bool Map::areAdjacent(int from, int to)
+{
+  if (edgeIndex.size() != (int)territories.size())
+  {
+    buildEdgeIndex();
+  }
+  return edgeIndex.contains(from, to);
+}
+
+/**
+ * @brief Gets the hop distance and next-hop oracle of the map.
+ *
+ * @return The oracle, built first if territories were added since it was last built.
+ */
+const DistanceOracle &Map::getDistanceOracle()
+{
+  if (distanceOracle.size() != (int)territories.size())
+  {
+    buildDistanceOracle();
+  }
+  return distanceOracle;
+}
+
+/**
+ * @brief Gets the set of territories adjacent to any territory of a set.
+ *
+ * @param territorySet The territories whose neighbours are collected.
+ * @return Bitset of the IDs of the adjacent territories, which may include territories of the given set.
+ */
+TerritorySet Map::getNeighbourSet(const TerritorySet &territorySet)
+{
+  TerritorySet neighbours((int)territories.size());
+  territorySet.forEach([&](int id)
+                       { neighbours |= getNeighbourSet(id); });
+  return neighbours;
+}
+
+/**
+ * @brief Gets a continent by its dense ID.
+ *
+ * @param id The ID of the continent (0..N-1).
+ * @return Pointer to the continent.
+ */
+Continent *Map::getContinentById(int id)
+{
+  return this->continents.at(id);
 }
 
 // --------------------------------------------------
@@ -243,21 +532,131 @@ void Map::setWarn(bool _warn)
 // --------------------------------------------------
 
 /**
- * @brief Destructor for Map. Deletes all territories and continents associated with the map.
+ * @brief Destructor for Map. Releases all territories and continents associated with the map.
  */
 Map::~Map()
 {
-  for (auto t : territories)
+  freeContents();
+}
+
+/**
+ * @brief Releases all territories and continents owned by the map and empties it.
+ * They live in the arena and own no other memory, so they are released together with its blocks.
+ */
+void Map::freeContents()
+{
+  territories.clear();
+  continents.clear();
+  store.clear();
+  neighbourSets.clear();
+  distanceOracle.clear();
+  edgeIndex.clear();
+  symbols.clear();
+  arena.release();
+}
+
+/**
+ * @brief Deep copies the territories and continents of another map into this (empty) map.
+ *
+ * Everything is resolved by dense ID in a single linear pass, no name lookups are needed. The symbol table is
+ * copied as a whole, so names keep their symbols.
+ * Adjacency to territories that were never declared in the other map is dropped.
+ * The sizes are known up front, so the arena takes a single block.
+ *
+ * @param other The map to copy from.
+ */
+void Map::copyContents(const Map &other)
+{
+  this->store = other.store;
+  this->neighbourSets = other.neighbourSets;
+  this->distanceOracle = other.distanceOracle;
+  this->edgeIndex = other.edgeIndex;
+  this->symbols = other.symbols;
+
+  // Every allocation may need up to one pointer of padding
+  size_t bytes = 0;
+  for (auto c : other.continents)
   {
-    delete t;
+    bytes += sizeof(Continent) + c->territories.size() * sizeof(Territory *) + 2 * sizeof(void *);
   }
+  for (auto t : other.territories)
+  {
+    bytes += sizeof(Territory) + t->getAdjacentTerritories()->size() * sizeof(Territory *) + 2 * sizeof(void *);
+  }
+  arena.reserve(bytes);
 
-  for (auto c : continents)
+  this->continents.reserve(other.continents.size());
+  for (auto c : other.continents)
+  {
+    auto continent = createContinent(c->getNameSymbol(), c->getBonus());
+    continent->setId(c->getId());
+    continent->territories.reserve(c->territories.size());
+    this->continents.push_back(continent);
+  }
+
+  this->territories.reserve(other.territories.size());
+  for (auto t : other.territories)
   {
-    delete c;
+    auto territory = arena.create<Territory>(arena, symbols, *t);
+    territory->attach(this, t->getId());
+    this->territories.push_back(territory);
+  }
+
+  int size = (int)this->territories.size();
+  for (auto territory : this->territories)
+  {
+    // remap adjacency onto the copies, in place
+    auto adjacent = territory->getAdjacentTerritories();
+    size_t kept = 0;
+    for (auto a : *adjacent)
+    {
+      int adjacentId = a->getId();
+      if (adjacentId >= 0 && adjacentId < size && other.territories[adjacentId] == a)
+      {
+        (*adjacent)[kept++] = this->territories[adjacentId];
+      }
+    }
+    adjacent->resize(kept);
+
+    auto continent = territory->getContinent();
+    if (continent != nullptr && continent->getId() != -1)
+    {
+      territory->setContinent(this->continents[continent->getId()]);
+    }
+  }
+
+  for (size_t i = 0; i < other.continents.size(); i++)
+  {
+    auto &continentTerritories = this->continents[i]->territories;
+    continentTerritories.reserve(other.continents[i]->territories.size());
+    for (auto t : other.continents[i]->territories)
+    {
+      continentTerritories.push_back(this->territories[t->getId()]);
+    }
   }
 }
 
+/**
+ * @brief Creates a deep copy of the map, owned by the given game engine.
+ *
+ * Territory owners are copied as player IDs, so they resolve against the players of the target game.
+ *
+ * @param targetGame The game engine the copy belongs to.
+ * @return Pointer to the new map. The caller takes ownership.
+ */
+Map *Map::clone(GameEngine *targetGame) const
+{
+  auto copy = new Map(targetGame);
+  copy->name = this->name;
+  copy->image = this->image;
+  copy->author = this->author;
+  copy->wrap = this->wrap;
+  copy->scroll = this->scroll;
+  copy->warn = this->warn;
+  copy->copyContents(*this);
+  return copy;
+}
+
 /**
  * @brief Overloaded stream insertion operator for Map.
  *
@@ -298,15 +697,7 @@ Map::Map(const Map &other)
     : name(other.name), author(other.author), warn(other.warn), scroll(other.scroll), image(other.image), wrap(other.wrap), game(other.game)
 {
   // Deep copy
-  for (auto t : territories)
-  {
-    this->addTerritory(new Territory(*t));
-  }
-  // Deep copy
-  for (auto c : continents)
-  {
-    this->addContinent(new Continent(*c));
-  }
+  copyContents(other);
 }
 
 /**
@@ -330,11 +721,12 @@ Map &Map::operator=(const Map &other)
   this->scroll = other.scroll;
   this->warn = other.warn;
 
-  this->continents = other.continents;
-  this->territories = other.territories;
-
   this->game = other.game;
 
+  // Deep copy
+  freeContents();
+  copyContents(other);
+
   return *this;
 }
 
@@ -362,10 +754,28 @@ Map::Map(GameEngine *game)
 /**
  * @brief Constructor for Territory.
  *
- * @param name The name of the territory.
+ * @param arena The arena of the map creating the territory, which holds its adjacency.
+ * @param symbols The symbol table of the map.
+ * @param name The symbol of the name of the territory.
+ */
+Territory::Territory(MapArena &arena, const SymbolTable &symbols, uint32_t name)
+    : continent(nullptr), name(name), symbols(&symbols), adjacentTerritories(ArenaAllocator<Territory *>(&arena)),
+      player(nullptr)
+{
+}
+
+/**
+ * @brief Copies a territory into the arena of another map. Adjacency still points at the territories of the
+ * original map until remapped.
+ *
+ * @param arena The arena of the map receiving the copy.
+ * @param symbols The symbol table of the map receiving the copy, a copy of the one of the original map.
+ * @param other The Territory object to be copied.
  */
-Territory::Territory(std::string name)
-    : name(std::move(name)), continent(nullptr), player(nullptr)
+Territory::Territory(MapArena &arena, const SymbolTable &symbols, const Territory &other)
+    : continent(other.continent), name(other.name), symbols(&symbols),
+      adjacentTerritories(other.adjacentTerritories.begin(), other.adjacentTerritories.end(), ArenaAllocator<Territory *>(&arena)),
+      id(other.id), map(other.map), armies(other.armies), player(other.player), x(other.x), y(other.y)
 {
 }
 
@@ -377,6 +787,20 @@ Territory::Territory(std::string name)
 void Territory::addAdjacentTerritory(Territory *territory)
 {
   this->adjacentTerritories.push_back(territory);
+  if (map)
+  {
+    map->invalidateAdjacency();
+  }
+}
+
+/**
+ * @brief Reserves room for adjacent territories, so the list is allocated once in the arena.
+ *
+ * @param count The number of adjacent territories about to be added.
+ */
+void Territory::reserveAdjacentTerritories(size_t count)
+{
+  this->adjacentTerritories.reserve(this->adjacentTerritories.size() + count);
 }
 
 /**
@@ -385,16 +809,58 @@ void Territory::addAdjacentTerritory(Territory *territory)
  * @return The name of the territory.
  */
 std::string Territory::getName()
+{
+  return symbols->text(this->name);
+}
+
+/**
+ * @brief Gets the symbol of the name of the territory, which identifies the name within its map.
+ *
+ * @return The symbol of the name.
+ */
+uint32_t Territory::getNameSymbol() const
 {
   return this->name;
 }
 
+/**
+ * @brief Gets the dense ID of the territory within its map.
+ *
+ * @return The ID of the territory, or -1 if it has not been added to a map.
+ */
+int Territory::getId() const
+{
+  return this->id;
+}
+
+/**
+ * @brief Sets the dense ID of the territory within its map.
+ *
+ * @param _id The ID to set.
+ */
+void Territory::setId(int _id)
+{
+  this->id = _id;
+}
+
+/**
+ * @brief Attaches the territory to a map, after which its armies, owner and continent are read from the map's store.
+ *
+ * @param _map The map owning the territory.
+ * @param _id The ID of the territory within the map.
+ */
+void Territory::attach(Map *_map, int _id)
+{
+  this->map = _map;
+  this->id = _id;
+}
+
 /**
  * @brief Gets a pointer to the vector of adjacent territories.
  *
  * @return Pointer to the vector of adjacent territories.
  */
-std::vector<Territory *> *Territory::getAdjacentTerritories()
+TerritoryList *Territory::getAdjacentTerritories()
 {
   return &this->adjacentTerritories;
 }
@@ -457,15 +923,12 @@ Continent *Territory::getContinent()
 void Territory::setContinent(Continent *c)
 {
   this->continent = c;
+  if (map)
+  {
+    map->getStore()->continent[id] = c ? c->getId() : -1;
+  }
 }
 
-/**
- * @brief Copy constructor for Territory.
- *
- * @param other The Territory object to be copied.
- */
-Territory::Territory(const Territory &other) = default;
-
 /**
  * @brief Copy assignment operator for Territory.
  *
@@ -480,6 +943,9 @@ Territory &Territory::operator=(const Territory &other)
   }
 
   this->name = other.name;
+  this->symbols = other.symbols;
+  this->id = other.id;
+  this->map = other.map;
   this->continent = other.continent;
   this->player = other.player;
 
@@ -501,7 +967,7 @@ Territory &Territory::operator=(const Territory &other)
  */
 std::ostream &operator<<(std::ostream &stream, const Territory &other)
 {
-  stream << "Territory Name: " << other.name << '\n'
+  stream << "Territory Name: " << other.symbols->c_str(other.name) << '\n'
          << "Territory Coordinates: " << '(' << other.x << ", " << other.y << ')' << '\n';
   return stream;
 }
@@ -513,6 +979,10 @@ std::ostream &operator<<(std::ostream &stream, const Territory &other)
  */
 int Territory::getArmies() const
 {
+  if (map)
+  {
+    return map->getStore()->armies[id];
+  }
   return this->armies;
 }
 
@@ -523,6 +993,11 @@ int Territory::getArmies() const
  */
 void Territory::setArmies(int army_units)
 {
+  if (map)
+  {
+    map->getStore()->setArmies(id, army_units);
+    return;
+  }
   this->armies = army_units;
 }
 
@@ -538,12 +1013,12 @@ int Territory::removeArmyUnits(int removed)
   {
     throw std::runtime_error("Cannot remove a negative amount of army units.");
   }
-  int total = this->armies - removed;
+  int total = getArmies() - removed;
   if (total < 0)
   {
     throw std::runtime_error("Cannot remove more armies than the territory currently has.");
   }
-  this->armies = total;
+  setArmies(total);
   return total;
 }
 
@@ -559,8 +1034,8 @@ int Territory::addArmyUnits(int added)
   {
     throw std::runtime_error("Cannot add a negative amount of army units.");
   }
-  int total = this->armies + added;
-  this->armies = total;
+  int total = getArmies() + added;
+  setArmies(total);
   return total;
 }
 
@@ -571,6 +1046,10 @@ int Territory::addArmyUnits(int added)
  */
 Player *Territory::getPlayer()
 {
+  if (map)
+  {
+    return map->getOwner(map->getStore()->owner[id]);
+  }
   return this->player;
 }
 
@@ -581,6 +1060,11 @@ Player *Territory::getPlayer()
  */
 void Territory::setPlayer(Player *p)
 {
+  if (map)
+  {
+    map->setOwner(id, p);
+    return;
+  }
   this->player = p;
 }
 
@@ -590,8 +1074,13 @@ void Territory::setPlayer(Player *p)
  * @param pTerritory The territory to check for adjacency.
  * @return True if the territories are adjacent, false otherwise.
  */
-bool Territory::isAdjacent(Territory *&pTerritory)
+bool Territory::isAdjacent(Territory *pTerritory)
 {
+  // Territories of the same map are answered by the map's edge index
+  if (map && pTerritory && pTerritory->map == map)
+  {
+    return map->areAdjacent(id, pTerritory->id);
+  }
   for (auto t : this->adjacentTerritories)
   {
     if (t == pTerritory)
@@ -612,13 +1101,14 @@ bool Territory::isAdjacent(Territory *&pTerritory)
 /**
  * @brief Constructor for Continent.
  *
- * @param name The name of the continent.
+ * @param arena The arena of the map creating the continent, which holds its territory list.
+ * @param symbols The symbol table of the map.
+ * @param name The symbol of the name of the continent.
  * @param bonus The bonus associated with the continent.
  */
-Continent::Continent(std::string name, int bonus)
+Continent::Continent(MapArena &arena, const SymbolTable &symbols, uint32_t name, int bonus)
+    : territories(ArenaAllocator<Territory *>(&arena)), name(name), symbols(&symbols), bonus(bonus)
 {
-  this->name = std::move(name);
-  this->bonus = bonus;
 }
 
 /**
@@ -637,6 +1127,16 @@ void Continent::addTerritory(Territory *territory)
  * @return The name of the continent.
  */
 std::string Continent::getName()
+{
+  return symbols->text(this->name);
+}
+
+/**
+ * @brief Gets the symbol of the name of the continent, which identifies the name within its map.
+ *
+ * @return The symbol of the name.
+ */
+uint32_t Continent::getNameSymbol() const
 {
   return this->name;
 }
@@ -651,12 +1151,32 @@ int Continent::getBonus() const
   return this->bonus;
 }
 
+/**
+ * @brief Gets the dense ID of the continent within its map.
+ *
+ * @return The ID of the continent, or -1 if it has not been added to a map.
+ */
+int Continent::getId() const
+{
+  return this->id;
+}
+
+/**
+ * @brief Sets the dense ID of the continent within its map.
+ *
+ * @param _id The ID to set.
+ */
+void Continent::setId(int _id)
+{
+  this->id = _id;
+}
+
 /**
  * @brief Gets a pointer to the vector of territories in the continent.
  *
  * @return Pointer to the vector of territories in the continent.
  */
-std::vector<Territory *> *Continent::getTerritories()
+TerritoryList *Continent::getTerritories()
 {
   return &this->territories;
 }
@@ -670,7 +1190,7 @@ std::vector<Territory *> *Continent::getTerritories()
  */
 std::ostream &operator<<(std::ostream &stream, const Continent &other)
 {
-  stream << "Continent Name: " << other.name << '\n'
+  stream << "Continent Name: " << other.symbols->c_str(other.name) << '\n'
          << "Continent Bonus: " << other.bonus << '\n';
 
   stream << "Continent Territories: " << '\n';
@@ -694,19 +1214,14 @@ Continent &Continent::operator=(const Continent &other)
     return *this;
   }
   this->name = other.name;
+  this->symbols = other.symbols;
   this->bonus = other.bonus;
+  this->id = other.id;
   this->territories = other.territories;
 
   return *this;
 }
 
-/**
- * @brief Copy constructor for Continent.
- *
- * @param other The Continent object to be copied.
- */
-Continent::Continent(const Continent &other) = default;
-
 // -----------------------------------------------------------------------------------------------------------------
 //
 //
@@ -749,6 +1264,10 @@ void MapLoader::load(const std::string &path, Map *out_map)
 
   state.parseState = ReadingState_Idle;
   input_file.close();
+
+  // Precompute the distance tables while the map is loaded rather than during the first turn
+  out_map->buildDistanceOracle();
+  out_map->buildEdgeIndex();
 }
 
 /**
@@ -799,11 +1318,12 @@ void MapLoader::parseLine(std::string &line, Map *map, MapLoaderState &mapLoader
                 // parse continents
                 std::string delimiter = "=";
                 if (line.find(delimiter) != std::string::npos) {
-                    std::string name = line.substr(0, line.find(delimiter));
-                    std::string value = line.substr(line.find(delimiter) + 1, line.length());
+                    size_t nameLength = line.find(delimiter);
+                    std::string value = line.substr(nameLength + 1, line.length());
+                    uint32_t name = map->getSymbols()->intern(line.data(), nameLength);
                     Continent *continent;
                     try {
-                        continent = new Continent(name, std::stoi(value));
+                        continent = map->createContinent(name, std::stoi(value));
                     } catch (std::invalid_argument &e) {
                         throw std::runtime_error("Map Formatting Error: Invalid Continent Bonus.");
                     } catch (std::out_of_range &e) {
@@ -811,7 +1331,7 @@ void MapLoader::parseLine(std::string &line, Map *map, MapLoaderState &mapLoader
                     }
 
                     map->addContinent(continent);
-                    mapLoaderState.continents[name] = continent;
+                    symbolSlot(mapLoaderState.continents, name) = continent;
                 }
             }
             break;
@@ -819,35 +1339,37 @@ void MapLoader::parseLine(std::string &line, Map *map, MapLoaderState &mapLoader
         case ReadingState_Territories:
 
             // parse territories
-            std::string delimiter = ",";
-            // Territory
-            Territory *territory = nullptr;
-
-            if (line.find(delimiter) != std::string::npos) {
-                std::string name = line.substr(0, line.find(delimiter));
-                line = line.substr(line.find(delimiter) + 1, line.length());
-
-                // check if territory exists in territoriesToCreate before creating a new one
-                if (mapLoaderState.territoriesToCreate.find(name) != mapLoaderState.territoriesToCreate.end()) {
-                    territory = mapLoaderState.territoriesToCreate[name];
-                    // remove from territoriesToCreate
-                    mapLoaderState.territoriesToCreate.erase(name);
-                } else {
-                    territory = new Territory(name);
-                }
+            const char delimiter = ',';
+            SymbolTable *symbols = map->getSymbols();
+
+            size_t nameLength = line.find(delimiter);
+            if (nameLength == std::string::npos) {
+                throw std::runtime_error("Map Formatting Error: Invalid Territory: " + line);
             }
 
-            // parse the rest of the line
-            while (!line.empty()) {
-                auto delimiter_location = line.find(delimiter);
-                std::string value = line.substr(0, delimiter_location);
-                line = delimiter_location == std::string::npos ? "" : line.substr(delimiter_location + 1,
-                                                                                  line.length());
+            // Territory, unless it was already created as the neighbour of a territory declared before it
+            uint32_t name = symbols->intern(line.data(), nameLength);
+            Territory *&toCreate = symbolSlot(mapLoaderState.territoriesToCreate, name);
+            Territory *territory = toCreate != nullptr ? toCreate : map->createTerritory(name);
+            toCreate = nullptr;
+            // x, y and continent come first, then one field per adjacent territory
+            territory->reserveAdjacentTerritories(std::max<long>(std::count(line.begin(), line.end(), delimiter) - 3, 0));
+
+            // parse the rest of the line, one field at a time
+            size_t position = nameLength + 1;
+            while (position < line.size()) {
+                size_t fieldEnd = line.find(delimiter, position);
+                if (fieldEnd == std::string::npos) {
+                    fieldEnd = line.size();
+                }
+                const char *field = line.data() + position;
+                size_t fieldLength = fieldEnd - position;
+                position = fieldEnd + 1;
 
                 // x
                 if (territory->getX() == -1) {
                     try {
-                        territory->setX(std::stoi(value));
+                        territory->setX(std::stoi(std::string(field, fieldLength)));
                     } catch (std::invalid_argument &e) {
                         throw std::runtime_error("Map Formatting Error: Invalid X Coordinate.");
                     } catch (std::out_of_range &e) {
@@ -858,7 +1380,7 @@ void MapLoader::parseLine(std::string &line, Map *map, MapLoaderState &mapLoader
                     // y
                 else if (territory->getY() == -1) {
                     try {
-                        territory->setY(std::stoi(value));
+                        territory->setY(std::stoi(std::string(field, fieldLength)));
                     } catch (std::invalid_argument &e) {
                         throw std::runtime_error("Map Formatting Error: Invalid Y Coordinate.");
                     } catch (std::out_of_range &e) {
@@ -868,43 +1390,55 @@ void MapLoader::parseLine(std::string &line, Map *map, MapLoaderState &mapLoader
                 }
                     // continent
                 else if (territory->getContinent() == nullptr) {
-                    // check if continents exists in hashmap
-                    if (mapLoaderState.continents.find(value) == mapLoaderState.continents.end()) {
-                        throw std::runtime_error("Invalid continent: " + value);
-                    } else {
-                        territory->setContinent(mapLoaderState.continents[value]);
-                        mapLoaderState.continents[value]->addTerritory(territory);
+                    // look the continent up without interning unknown names
+                    uint32_t continentName = symbols->find(field, fieldLength);
+                    Continent *continent = continentName < mapLoaderState.continents.size()
+                                           ? mapLoaderState.continents[continentName] : nullptr;
+                    if (continent == nullptr) {
+                        throw std::runtime_error("Invalid continent: " + std::string(field, fieldLength));
                     }
+                    territory->setContinent(continent);
+                    continent->addTerritory(territory);
                     continue;
                 }
                     // adjacent territories
                 else {
-                    // check if territory exists in hashmap
-                    if (mapLoaderState.territories.find(value) != mapLoaderState.territories.end()) {
-                        territory->addAdjacentTerritory(mapLoaderState.territories[value]);
-                    } else {
-                        Territory *adjacentTerritory;
-                        // check inside territories to create
-                        if (mapLoaderState.territoriesToCreate.find(value) !=
-                            mapLoaderState.territoriesToCreate.end()) {
-                            // use previously created
-                            adjacentTerritory = mapLoaderState.territoriesToCreate[value];
-                        } else {
-                            // create new territory
-                            adjacentTerritory = new Territory(value);
+                    uint32_t adjacentName = symbols->intern(field, fieldLength);
+                    Territory *adjacentTerritory = symbolSlot(mapLoaderState.territories, adjacentName);
+                    if (adjacentTerritory == nullptr) {
+                        // use the territory created by a previous reference, or create it until it is declared
+                        Territory *&adjacentToCreate = symbolSlot(mapLoaderState.territoriesToCreate, adjacentName);
+                        if (adjacentToCreate == nullptr) {
+                            adjacentToCreate = map->createTerritory(adjacentName);
                         }
-                        territory->addAdjacentTerritory(adjacentTerritory);
-                        // add to territoriesToCreate
-                        mapLoaderState.territoriesToCreate[value] = adjacentTerritory;
+                        adjacentTerritory = adjacentToCreate;
                     }
+                    territory->addAdjacentTerritory(adjacentTerritory);
                 }
             }
-            mapLoaderState.territories[territory->getName()] = territory;
+            symbolSlot(mapLoaderState.territories, name) = territory;
             map->addTerritory(territory);
             break;
     }
 }
 
+/**
+ * @brief Gets the slot of a symbol in one of the loader's indexes, growing the index to cover it.
+ *
+ * @param index The index, by symbol.
+ * @param symbol The symbol.
+ * @return The slot, nullptr if nothing was stored for the symbol yet.
+ */
+template <typename T>
+T *&MapLoader::symbolSlot(std::vector<T *> &index, uint32_t symbol)
+{
+  if (symbol >= index.size())
+  {
+    index.resize(std::max<size_t>(symbol + 1, index.size() * 2), nullptr);
+  }
+  return index[symbol];
+}
+
 /**
  * @brief Trims leading whitespaces from a string.
  *
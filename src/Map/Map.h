@@ -8,6 +8,12 @@
 #include <unordered_map>
 #include <fstream>
 
+#include "Map/TerritorySet.h"
+#include "Map/TerritoryStore.h"
+#include "Map/DistanceOracle.h"
+#include "Map/EdgeIndex.h"
+#include "Map/MapArena.h"
+#include "Map/SymbolTable.h"
 #include "GameEngine/GameEngine.h"
 #include "Player/Player.h"
 
@@ -18,20 +24,33 @@
 //
 // ----------------------------------------------------------------------------------------------------------------
 
+class Territory;
 class Continent;
 class GameEngine;
 class Player;
+class Map;
+
+// List of territories stored in the arena of their map
+typedef std::vector<Territory *, ArenaAllocator<Territory *>> TerritoryList;
 
 /**
- * @brief Represents a territory in the game map.
+ * @brief Represents a territory in the game map. Territories are created by their map, in its arena.
  */
 class Territory
 {
 private:
   Continent *continent;
-  std::string name;
-  std::vector<Territory *> adjacentTerritories;
+  // Symbol of the name in the symbol table of the map
+  uint32_t name;
+  const SymbolTable *symbols;
+  TerritoryList adjacentTerritories;
 
+  // Dense index into the owning map (0..N-1), -1 until the territory is added to a map
+  int id = -1;
+
+  // Once attached to a map, armies, owner and continent live in the map's TerritoryStore.
+  // The fields below only hold that state while the territory is detached.
+  Map *map = nullptr;
   int armies = 0;
   Player *player;
 
@@ -40,12 +59,18 @@ private:
 
 public:
   // Constructors
-  explicit Territory(std::string name);
-  Territory(const Territory &other);
+  Territory(MapArena &arena, const SymbolTable &symbols, uint32_t name);
+  Territory(MapArena &arena, const SymbolTable &symbols, const Territory &other);
+  // A plain copy would keep its adjacency in the arena of the source map
+  Territory(const Territory &other) = delete;
 
   // Getters and Setters
   std::string getName();
-  std::vector<Territory *> *getAdjacentTerritories();
+  uint32_t getNameSymbol() const;
+  int getId() const;
+  void setId(int id);
+  void attach(Map *map, int id);
+  TerritoryList *getAdjacentTerritories();
   int getArmies() const;
   void setArmies(int);
   Player *getPlayer();
@@ -61,6 +86,7 @@ public:
   int removeArmyUnits(int);
   int addArmyUnits(int);
   void addAdjacentTerritory(Territory *territory);
+  void reserveAdjacentTerritories(size_t count);
 
   // Operator Overloads
   Territory &operator=(const Territory &other);
@@ -69,7 +95,7 @@ public:
   friend std::ostream &operator<<(std::ostream &stream, const Territory &other);
 
   // Additional Methods
-  bool isAdjacent(Territory *&pTerritory);
+  bool isAdjacent(Territory *pTerritory);
 };
 
 // -----------------------------------------------------------------------------------------------------------------
@@ -85,6 +111,12 @@ public:
   std::vector<Continent *> continents;
 
 private:
+  // Territories, continents and their lists; declared first so it is released last
+  MapArena arena;
+
+  // Names of the territories and continents
+  SymbolTable symbols;
+
   std::string name;
   std::string image;
   std::string author;
@@ -95,14 +127,31 @@ private:
 
   std::vector<Territory *> territories;
 
+  // Hot territory state (armies, owner, continent) indexed by territory ID
+  TerritoryStore store;
+
+  // Neighbour bitset per territory ID, built lazily on first query
+  std::vector<TerritorySet> neighbourSets;
+
+  // Hop distances between territories, built when the map is loaded or on first query
+  DistanceOracle distanceOracle;
+
+  // Hash set of the (from, to) edges, built when the map is loaded or on first query
+  EdgeIndex edgeIndex;
+
   // Object Owner
   GameEngine *game;
 
 private:
   bool isMapStronglyConnected();
   bool isTerritories1to1Continents();
-  void DFS(Territory *territory, std::vector<Territory *> &visited);
+  int DFS(Territory *territory, std::vector<char> &visited);
   bool isTerritoryStronglyConnected(Territory *territory);
+  void buildNeighbourSets();
+  void buildAdjacency(std::vector<int32_t> &start, std::vector<int32_t> &neighbours);
+  void copyContents(const Map &other);
+  void freeContents();
+  bool isGameMap();
 
 public:
   // Destructors + Constructors + Operator Overloads
@@ -111,10 +160,37 @@ public:
   bool validate();
   Map(const Map &other);
   Map &operator=(const Map &other);
+  Map *clone(GameEngine *targetGame) const;
 
   // Map Adders
+  Continent *createContinent(uint32_t name, int bonus);
+  Territory *createTerritory(uint32_t name);
   void addContinent(Continent *continent);
   void addTerritory(Territory *territory);
+  const MapArena &getArena() const;
+  SymbolTable *getSymbols();
+
+  // ID Lookups
+  Territory *getTerritoryById(int id);
+  Continent *getContinentById(int id);
+
+  // Territory State
+  TerritoryStore *getStore();
+  Player *getOwner(int ownerId);
+  void setOwner(int id, Player *player);
+
+  // Bitset Queries
+  const TerritorySet &getNeighbourSet(int id);
+  TerritorySet getNeighbourSet(const TerritorySet &territorySet);
+
+  // Distance Queries
+  void buildDistanceOracle();
+  const DistanceOracle &getDistanceOracle();
+
+  // Adjacency Queries
+  void buildEdgeIndex();
+  void invalidateAdjacency();
+  bool areAdjacent(int from, int to);
 
   // Setters
   void setName(std::string _name);
@@ -146,29 +222,38 @@ public:
 // ----------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Represents a continent in the game map.
+ * @brief Represents a continent in the game map. Continents are created by their map, in its arena.
  */
 class Continent
 {
 public:
-  std::vector<Territory *> territories;
+  TerritoryList territories;
 
 private:
-  std::string name;
+  // Symbol of the name in the symbol table of the map
+  uint32_t name;
+  const SymbolTable *symbols;
   int bonus;
 
+  // Dense index into the owning map (0..N-1), -1 until the continent is added to a map
+  int id = -1;
+
 public:
   // Constructors
-  Continent(std::string name, int bonus);
-  Continent(const Continent &other);
+  Continent(MapArena &arena, const SymbolTable &symbols, uint32_t name, int bonus);
+  // A plain copy would keep its territory list in the arena of the source map
+  Continent(const Continent &other) = delete;
 
   // Adders
   void addTerritory(Territory *territory);
 
   // Getters
   std::string getName();
+  uint32_t getNameSymbol() const;
   int getBonus() const;
-  std::vector<Territory *> *getTerritories();
+  int getId() const;
+  void setId(int id);
+  TerritoryList *getTerritories();
 
   // Operator Overloads
   Continent &operator=(const Continent &other);
@@ -202,14 +287,20 @@ private:
   };
 
   // Map Loader Data / State
+  // Territories and continents are indexed by the symbol of their name, interned while the line is split
   struct MapLoaderState
   {
-    std::unordered_map<std::string, Territory *> territories;
-    std::unordered_map<std::string, Territory *> territoriesToCreate;
-    std::unordered_map<std::string, Continent *> continents;
+    std::vector<Territory *> territories;
+    // Territories referenced as adjacent before being declared
+    std::vector<Territory *> territoriesToCreate;
+    std::vector<Continent *> continents;
     ReadingState parseState = ReadingState_Idle;
   };
 
+  // Slot of a symbol in one of the loader's indexes, grown as needed
+  template <typename T>
+  static T *&symbolSlot(std::vector<T *> &index, uint32_t symbol);
+
   // Map Loader Parse Line
   static void parseLine(std::string &line, Map *map, MapLoaderState &mapLoaderState);
 
@@ -0,0 +1,110 @@
+#include "MapArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+const size_t MapArena::FIRST_BLOCK_SIZE;
+
+/**
+ * @brief Starts a new block large enough for an allocation, at least twice as large as the previous one.
+ * The rest of the current block is abandoned.
+ *
+ * @param bytes The size of the allocation.
+ * @param alignment The alignment of the allocation.
+ */
+void MapArena::grow(size_t bytes, size_t alignment)
+{
+  // The block start is aligned for any type, so the padding only matters for over-aligned allocations
+  size_t size = nextBlockSize;
+  while (size < bytes + alignment - 1)
+  {
+    size *= 2;
+  }
+  blocks.emplace_back(new char[size]);
+  cursor = blocks.back().get();
+  end = cursor + size;
+  reserved += size;
+  nextBlockSize = size * 2;
+}
+
+/**
+ * @brief Allocates uninitialized memory by bumping the cursor of the current block.
+ *
+ * @param bytes The size of the allocation.
+ * @param alignment The alignment of the allocation, a power of two.
+ * @return The memory, valid until the arena is released.
+ */
+void *MapArena::allocate(size_t bytes, size_t alignment)
+{
+  size_t padding = (alignment - (uintptr_t)cursor % alignment) % alignment;
+  if (cursor == nullptr || padding + bytes > (size_t)(end - cursor))
+  {
+    grow(bytes, alignment);
+    padding = (alignment - (uintptr_t)cursor % alignment) % alignment;
+  }
+  char *memory = cursor + padding;
+  cursor = memory + bytes;
+  used += padding + bytes;
+  return memory;
+}
+
+/**
+ * @brief Makes sure the next allocations, up to a total size, fit in the current block, starting a block of
+ * exactly that size if needed.
+ *
+ * @param bytes The total size of the next allocations.
+ */
+void MapArena::reserve(size_t bytes)
+{
+  if (bytes == 0 || (cursor != nullptr && bytes <= (size_t)(end - cursor)))
+  {
+    return;
+  }
+  size_t next = nextBlockSize;
+  nextBlockSize = bytes;
+  grow(bytes, 1);
+  nextBlockSize = std::max(next, nextBlockSize);
+}
+
+/**
+ * @brief Frees every block at once. Everything allocated from the arena becomes invalid.
+ */
+void MapArena::release()
+{
+  blocks.clear();
+  cursor = nullptr;
+  end = nullptr;
+  nextBlockSize = FIRST_BLOCK_SIZE;
+  used = 0;
+  reserved = 0;
+}
+
+/**
+ * @brief Gets the number of bytes handed out since the arena was last released, padding included.
+ *
+ * @return The number of bytes used.
+ */
+size_t MapArena::bytesUsed() const
+{
+  return used;
+}
+
+/**
+ * @brief Gets the total size of the blocks.
+ *
+ * @return The number of bytes reserved.
+ */
+size_t MapArena::bytesReserved() const
+{
+  return reserved;
+}
+
+/**
+ * @brief Gets the number of blocks, i.e. the number of frees needed to release the arena.
+ *
+ * @return The number of blocks.
+ */
+size_t MapArena::blockCount() const
+{
+  return blocks.size();
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Monotonic allocator owning everything a map is built from: territories, continents, and their adjacency
+ * and membership lists.
+ *
+ * Allocation bumps a pointer through the current block and nothing is freed on its own: the blocks are released
+ * together when the map is emptied or destroyed. Each block is twice as large as the previous one, so a map of N
+ * territories takes O(log N) blocks, or a single one when the size is known up front, e.g. when cloning a map.
+ *
+ * Objects placed in the arena must not own heap memory, as their destructors are not relied upon to free anything.
+ */
+class MapArena
+{
+private:
+  std::vector<std::unique_ptr<char[]>> blocks;
+  char *cursor = nullptr;
+  char *end = nullptr;
+  size_t nextBlockSize = FIRST_BLOCK_SIZE;
+  size_t used = 0;
+  size_t reserved = 0;
+
+  /**
+   * @brief Starts a new block large enough for an allocation.
+   *
+   * @param bytes The size of the allocation.
+   * @param alignment The alignment of the allocation.
+   */
+  void grow(size_t bytes, size_t alignment);
+
+public:
+  static const size_t FIRST_BLOCK_SIZE = 4096;
+
+  MapArena() = default;
+  MapArena(const MapArena &other) = delete;
+  MapArena &operator=(const MapArena &other) = delete;
+
+  /**
+   * @brief Allocates uninitialized memory.
+   *
+   * @param bytes The size of the allocation.
+   * @param alignment The alignment of the allocation, a power of two.
+   * @return The memory, valid until the arena is released.
+   */
+  void *allocate(size_t bytes, size_t alignment);
+
+  /**
+   * @brief Constructs an object in the arena.
+   *
+   * @param args The arguments of the constructor.
+   * @return The object, valid until the arena is released.
+   */
+  template <typename T, typename... Args>
+  T *create(Args &&...args)
+  {
+    return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Makes sure the next allocations, up to a total size, fit in the current block.
+   *
+   * @param bytes The total size of the next allocations.
+   */
+  void reserve(size_t bytes);
+
+  /**
+   * @brief Frees every block at once. Everything allocated from the arena becomes invalid.
+   */
+  void release();
+
+  /**
+   * @brief Gets the number of bytes handed out since the arena was last released, padding included.
+   *
+   * @return The number of bytes used.
+   */
+  size_t bytesUsed() const;
+
+  /**
+   * @brief Gets the total size of the blocks.
+   *
+   * @return The number of bytes reserved.
+   */
+  size_t bytesReserved() const;
+
+  /**
+   * @brief Gets the number of blocks, i.e. the number of frees needed to release the arena.
+   *
+   * @return The number of blocks.
+   */
+  size_t blockCount() const;
+};
+
+/**
+ * @brief Standard allocator drawing from a MapArena, for containers that live in the arena.
+ *
+ * Deallocation does nothing: memory given back by a growing container is only reclaimed with the arena, so
+ * containers should be reserved to their final size when it is known.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+  typedef T value_type;
+
+  MapArena *arena;
+
+  explicit ArenaAllocator(MapArena *arena) : arena(arena)
+  {
+  }
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena)
+  {
+  }
+
+  T *allocate(size_t count)
+  {
+    return static_cast<T *>(arena->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *, size_t)
+  {
+  }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U> &other) const
+  {
+    return arena == other.arena;
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U> &other) const
+  {
+    return arena != other.arena;
+  }
+};
@@ -1,3 +1,6 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <memory>
 
@@ -44,3 +47,172 @@ void testLoadMaps()
     }
   }
 }
+
+/**
+ * @brief Benchmarks deep cloning a map against reloading it from disk.
+ */
+void benchmarkMapClone()
+{
+  const std::string mapFile = "res/TestMap1_valid.map";
+  const int iterations = 1000;
+
+  // Mocking argc and argv
+  int argc = 1;
+  char *argv[] = {(char *)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  MapLoader::load(mapFile, gameEngine.getMap());
+
+  // Reload from disk through the MapLoader
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+  {
+    Map map(&gameEngine);
+    MapLoader::load(mapFile, &map);
+  }
+  auto loadTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  // Deep clone of the already loaded map
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+  {
+    delete gameEngine.getMap()->clone(&gameEngine);
+  }
+  auto cloneTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "Map: " << mapFile << " (" << gameEngine.getMap()->getTerritories()->size() << " territories)" << std::endl;
+  std::cout << "MapLoader::load: " << loadTime / iterations << " us per map" << std::endl;
+  std::cout << "Map::clone:      " << cloneTime / iterations << " us per map" << std::endl;
+}
+
+/**
+ * @brief Benchmarks loading and destroying a synthetic 100k-territory map, as a tournament does on every reload.
+ *
+ * The map is a 250 x 400 grid of territories in 100 continents, each adjacent to its four neighbours, written so
+ * that most adjacency refers to territories that are declared further down the file.
+ */
+void benchmarkMapLoad()
+{
+  const std::string mapFile = "benchmark_100k.map";
+  const int width = 250;
+  const int height = 400;
+  const int iterations = 5;
+
+  {
+    std::ofstream out(mapFile, std::ios::out | std::ios::trunc);
+    out << "[Map]\nauthor=benchmark\n\n[Continents]\n";
+    for (int c = 0; c < 100; c++)
+    {
+      out << "Continent" << c << "=" << c % 7 + 1 << "\n";
+    }
+    out << "\n[Territories]\n";
+    for (int y = 0; y < height; y++)
+    {
+      for (int x = 0; x < width; x++)
+      {
+        out << "Territory" << y * width + x << "," << x << "," << y << ",Continent" << (y / 40) * 10 + x / 25;
+        const int dx[] = {1, 0, -1, 0};
+        const int dy[] = {0, 1, 0, -1};
+        for (int d = 0; d < 4; d++)
+        {
+          int nx = x + dx[d], ny = y + dy[d];
+          if (nx >= 0 && nx < width && ny >= 0 && ny < height)
+          {
+            out << ",Territory" << ny * width + nx;
+          }
+        }
+        out << "\n";
+      }
+    }
+  }
+
+  // Mocking argc and argv
+  int argc = 1;
+  char *argv[] = {(char *)"-console"};
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+
+  double loadTime = 0;
+  double destroyTime = 0;
+  size_t territories = 0;
+  size_t arenaBytes = 0;
+  size_t arenaBlocks = 0;
+  for (int i = 0; i < iterations; i++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    auto map = new Map(&gameEngine);
+    MapLoader::load(mapFile, map);
+    auto loaded = std::chrono::steady_clock::now();
+    territories = map->getTerritories()->size();
+    arenaBytes = map->getArena().bytesUsed();
+    arenaBlocks = map->getArena().blockCount();
+    delete map;
+    auto destroyed = std::chrono::steady_clock::now();
+    loadTime += std::chrono::duration<double, std::milli>(loaded - start).count();
+    destroyTime += std::chrono::duration<double, std::milli>(destroyed - loaded).count();
+  }
+  std::remove(mapFile.c_str());
+
+  std::cout << "Map load: " << territories << " territories, arena of " << arenaBytes / 1024 << " KiB in " << arenaBlocks
+            << " blocks" << std::endl;
+  std::cout << "MapLoader::load: " << loadTime / iterations << " ms per map" << std::endl;
+  std::cout << "Map::~Map:       " << destroyTime / iterations << " ms per map" << std::endl;
+}
+
+/**
+ * @brief Benchmarks the AVX2 and scalar bulk kernels of the territory store on a synthetic 1M-territory map.
+ */
+void benchmarkTerritoryKernels()
+{
+  const int territories = 1000000;
+  const int players = 6;
+  const int iterations = 200;
+
+  TerritoryStore store;
+  uint64_t rng = 1;
+  for (int i = 0; i < territories; i++)
+  {
+    rng = TerritoryStore::mixKey(rng);
+    store.add((int32_t)(rng % 50), (int32_t)((rng >> 32) % players), -1);
+  }
+
+  bool vectorized = TerritoryStore::isVectorized();
+  std::cout << "Territory kernels: " << territories << " territories, " << players << " players" << std::endl;
+  for (int pass = 0; pass < 2; pass++)
+  {
+    TerritoryStore::setVectorized(pass == 0);
+    if (pass == 0 && !TerritoryStore::isVectorized())
+    {
+      std::cout << "AVX2 is not supported on this CPU" << std::endl;
+      continue;
+    }
+    const char *name = pass == 0 ? "AVX2:  " : "scalar:";
+
+    long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+      checksum += store.sumArmiesByOwner(i % players);
+    }
+    auto sumTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+      checksum += store.armiesByOwner(players)[i % players];
+    }
+    auto allTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    // Adding and removing armies leaves the store as it was for the next pass
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+      store.addArmiesWhereOwner((i / 2) % players, i % 2 == 0 ? 3 : -3);
+    }
+    auto addTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << name << " sumArmiesByOwner " << sumTime / iterations << " us, armiesByOwner "
+              << allTime / iterations << " us, addArmiesWhereOwner " << addTime / iterations << " us (checksum "
+              << checksum << ")" << std::endl;
+  }
+  TerritoryStore::setVectorized(vectorized);
+}
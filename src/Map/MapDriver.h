@@ -4,3 +4,18 @@
  * @brief Test function for loading maps in the driver.
  */
 void testLoadMaps();
+
+/**
+ * @brief Benchmarks deep cloning a map against reloading it from disk.
+ */
+void benchmarkMapClone();
+
+/**
+ * @brief Benchmarks loading and destroying a synthetic 100k-territory map.
+ */
+void benchmarkMapLoad();
+
+/**
+ * @brief Benchmarks the AVX2 and scalar bulk kernels of the territory store on a synthetic 1M-territory map.
+ */
+void benchmarkTerritoryKernels();
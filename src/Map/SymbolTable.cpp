@@ -0,0 +1,193 @@
+#include "SymbolTable.h"
+
+#include <cstring>
+#include <stdexcept>
+
+const uint32_t SymbolTable::NONE;
+
+/**
+ * @brief Hashes a text with 32-bit FNV-1a.
+ *
+ * @param text The text.
+ * @param length The length of the text.
+ * @return The hash.
+ */
+uint32_t SymbolTable::hash(const char *text, size_t length)
+{
+  uint32_t value = 2166136261U;
+  for (size_t i = 0; i < length; i++)
+  {
+    value = (value ^ (uint8_t)text[i]) * 16777619U;
+  }
+  return value;
+}
+
+/**
+ * @brief Finds the slot of a text by linear probing. Texts are only compared when their hashes match.
+ *
+ * @param text The text.
+ * @param length The length of the text.
+ * @param textHash The hash of the text.
+ * @return The slot holding the symbol of the text, or the free slot where it would go.
+ */
+size_t SymbolTable::findSlot(const char *text, size_t length, uint32_t textHash) const
+{
+  size_t slot = textHash & mask;
+  while (slots[slot] != NONE)
+  {
+    uint32_t symbol = slots[slot];
+    if (hashes[symbol] == textHash && offsets[symbol + 1] - offsets[symbol] - 1 == length &&
+        memcmp(texts.data() + offsets[symbol], text, length) == 0)
+    {
+      return slot;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+/**
+ * @brief Doubles the number of slots and reinserts every symbol from its stored hash.
+ */
+void SymbolTable::grow()
+{
+  size_t capacity = slots.empty() ? 16 : slots.size() * 2;
+  slots.assign(capacity, NONE);
+  mask = (uint32_t)(capacity - 1);
+  for (uint32_t symbol = 0; symbol < size(); symbol++)
+  {
+    size_t slot = hashes[symbol] & mask;
+    while (slots[slot] != NONE)
+    {
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = symbol;
+  }
+}
+
+/**
+ * @brief Gets the symbol of a text, adding it if it is new.
+ *
+ * @param text The text.
+ * @param length The length of the text.
+ * @return The symbol.
+ * @throws std::runtime_error if the texts would no longer fit in 32-bit offsets.
+ */
+uint32_t SymbolTable::intern(const char *text, size_t length)
+{
+  if ((size() + 1) * 2 > slots.size())
+  {
+    grow();
+  }
+  uint32_t textHash = hash(text, length);
+  size_t slot = findSlot(text, length, textHash);
+  if (slots[slot] != NONE)
+  {
+    return slots[slot];
+  }
+  if (texts.size() + length + 1 > UINT32_MAX)
+  {
+    throw std::runtime_error("SymbolTable::Error | Too much text to intern");
+  }
+
+  uint32_t symbol = size();
+  texts.insert(texts.end(), text, text + length);
+  texts.push_back('\0');
+  offsets.push_back((uint32_t)texts.size());
+  hashes.push_back(textHash);
+  slots[slot] = symbol;
+  return symbol;
+}
+
+/**
+ * @brief Gets the symbol of a text, adding it if it is new.
+ *
+ * @param text The text.
+ * @return The symbol.
+ */
+uint32_t SymbolTable::intern(const std::string &text)
+{
+  return intern(text.data(), text.size());
+}
+
+/**
+ * @brief Looks up the symbol of a text without adding it.
+ *
+ * @param text The text.
+ * @param length The length of the text.
+ * @return The symbol, or NONE if the text was never interned.
+ */
+uint32_t SymbolTable::find(const char *text, size_t length) const
+{
+  if (slots.empty())
+  {
+    return NONE;
+  }
+  return slots[findSlot(text, length, hash(text, length))];
+}
+
+/**
+ * @brief Looks up the symbol of a text without adding it.
+ *
+ * @param text The text.
+ * @return The symbol, or NONE if the text was never interned.
+ */
+uint32_t SymbolTable::find(const std::string &text) const
+{
+  return find(text.data(), text.size());
+}
+
+/**
+ * @brief Gets the text of a symbol.
+ *
+ * @param symbol The symbol.
+ * @return The null-terminated text, valid until the next symbol is added.
+ */
+const char *SymbolTable::c_str(uint32_t symbol) const
+{
+  return texts.data() + offsets.at(symbol);
+}
+
+/**
+ * @brief Gets the text of a symbol.
+ *
+ * @param symbol The symbol.
+ * @return The text.
+ */
+std::string SymbolTable::text(uint32_t symbol) const
+{
+  return std::string(c_str(symbol), length(symbol));
+}
+
+/**
+ * @brief Gets the length of the text of a symbol.
+ *
+ * @param symbol The symbol.
+ * @return The length.
+ */
+size_t SymbolTable::length(uint32_t symbol) const
+{
+  return offsets.at(symbol + 1) - offsets[symbol] - 1;
+}
+
+/**
+ * @brief Gets the number of symbols.
+ *
+ * @return The number of symbols.
+ */
+uint32_t SymbolTable::size() const
+{
+  return (uint32_t)hashes.size();
+}
+
+/**
+ * @brief Removes every symbol.
+ */
+void SymbolTable::clear()
+{
+  texts.clear();
+  offsets.assign(1, 0);
+  hashes.clear();
+  slots.clear();
+  mask = 0;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Interns names into dense 32-bit symbols, so each name is stored once and compared as an integer.
+ *
+ * Symbols are handed out in order from 0, and copying a table keeps them. The texts are stored null-terminated one
+ * after the other in a single buffer, and looked up through an open-addressing hash table with linear probing,
+ * kept at most half full.
+ */
+class SymbolTable
+{
+private:
+  std::vector<char> texts;
+  // Start of each symbol in texts, followed by the end of the last one
+  std::vector<uint32_t> offsets{0};
+  // Hash of each symbol, so growing the table does not rehash the texts
+  std::vector<uint32_t> hashes;
+  // Symbols, NONE for free slots; the size is a power of two
+  std::vector<uint32_t> slots;
+  uint32_t mask = 0;
+
+  /**
+   * @brief Hashes a text.
+   *
+   * @param text The text.
+   * @param length The length of the text.
+   * @return The hash.
+   */
+  static uint32_t hash(const char *text, size_t length);
+
+  /**
+   * @brief Finds the slot of a text.
+   *
+   * @param text The text.
+   * @param length The length of the text.
+   * @param textHash The hash of the text.
+   * @return The slot holding the symbol of the text, or the free slot where it would go.
+   */
+  size_t findSlot(const char *text, size_t length, uint32_t textHash) const;
+
+  /**
+   * @brief Doubles the number of slots and reinserts every symbol.
+   */
+  void grow();
+
+public:
+  static const uint32_t NONE = ~0U;
+
+  /**
+   * @brief Gets the symbol of a text, adding it if it is new.
+   *
+   * @param text The text.
+   * @param length The length of the text.
+   * @return The symbol.
+   * @throws std::runtime_error if the texts would no longer fit in 32-bit offsets.
+   */
+  uint32_t intern(const char *text, size_t length);
+
+  /**
+   * @brief Gets the symbol of a text, adding it if it is new.
+   *
+   * @param text The text.
+   * @return The symbol.
+   */
+  uint32_t intern(const std::string &text);
+
+  /**
+   * @brief Looks up the symbol of a text without adding it.
+   *
+   * @param text The text.
+   * @param length The length of the text.
+   * @return The symbol, or NONE if the text was never interned.
+   */
+  uint32_t find(const char *text, size_t length) const;
+
+  /**
+   * @brief Looks up the symbol of a text without adding it.
+   *
+   * @param text The text.
+   * @return The symbol, or NONE if the text was never interned.
+   */
+  uint32_t find(const std::string &text) const;
+
+  /**
+   * @brief Gets the text of a symbol.
+   *
+   * @param symbol The symbol.
+   * @return The null-terminated text, valid until the next symbol is added.
+   */
+  const char *c_str(uint32_t symbol) const;
+
+  /**
+   * @brief Gets the text of a symbol.
+   *
+   * @param symbol The symbol.
+   * @return The text.
+   */
+  std::string text(uint32_t symbol) const;
+
+  /**
+   * @brief Gets the length of the text of a symbol.
+   *
+   * @param symbol The symbol.
+   * @return The length.
+   */
+  size_t length(uint32_t symbol) const;
+
+  /**
+   * @brief Gets the number of symbols.
+   *
+   * @return The number of symbols.
+   */
+  uint32_t size() const;
+
+  /**
+   * @brief Removes every symbol.
+   */
+  void clear();
+};
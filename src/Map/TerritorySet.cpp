@@ -0,0 +1,189 @@
+#include "TerritorySet.h"
+
+#include <algorithm>
+
+/**
+ * @brief Constructs an empty set with room for the given number of territories.
+ *
+ * @param size The number of territory IDs the set should hold without growing.
+ */
+TerritorySet::TerritorySet(int size)
+    : words((size + 63) / 64, 0)
+{
+}
+
+/**
+ * @brief Grows the set so that word w exists.
+ *
+ * @param w The index of the word required.
+ */
+void TerritorySet::ensureWord(int w)
+{
+  if (w >= (int)words.size())
+  {
+    words.resize(w + 1, 0);
+  }
+}
+
+/**
+ * @brief Adds a territory to the set.
+ *
+ * @param id The ID of the territory.
+ */
+void TerritorySet::set(int id)
+{
+  if (id < 0)
+  {
+    return;
+  }
+  ensureWord(id / 64);
+  words[id / 64] |= (uint64_t)1 << (id % 64);
+}
+
+/**
+ * @brief Removes a territory from the set.
+ *
+ * @param id The ID of the territory.
+ */
+void TerritorySet::reset(int id)
+{
+  if (id < 0 || id / 64 >= (int)words.size())
+  {
+    return;
+  }
+  words[id / 64] &= ~((uint64_t)1 << (id % 64));
+}
+
+/**
+ * @brief Checks whether a territory is in the set.
+ *
+ * @param id The ID of the territory.
+ * @return True if the territory is in the set, false otherwise.
+ */
+bool TerritorySet::test(int id) const
+{
+  if (id < 0 || id / 64 >= (int)words.size())
+  {
+    return false;
+  }
+  return (words[id / 64] >> (id % 64)) & 1;
+}
+
+/**
+ * @brief Removes every territory from the set.
+ */
+void TerritorySet::clear()
+{
+  std::fill(words.begin(), words.end(), 0);
+}
+
+/**
+ * @brief Counts the territories in the set.
+ *
+ * @return The number of set bits.
+ */
+int TerritorySet::count() const
+{
+  int total = 0;
+  for (auto word : words)
+  {
+    total += __builtin_popcountll(word);
+  }
+  return total;
+}
+
+/**
+ * @brief Checks whether the set contains at least one territory.
+ *
+ * @return True if the set is not empty, false otherwise.
+ */
+bool TerritorySet::any() const
+{
+  for (auto word : words)
+  {
+    if (word)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Gets the number of 64-bit words backing the set.
+ *
+ * @return The number of words.
+ */
+int TerritorySet::wordCount() const
+{
+  return (int)words.size();
+}
+
+/**
+ * @brief Intersects this set with another set.
+ *
+ * @param other The set to intersect with.
+ * @return Reference to this set.
+ */
+TerritorySet &TerritorySet::operator&=(const TerritorySet &other)
+{
+  int shared = (int)std::min(words.size(), other.words.size());
+  for (int w = 0; w < shared; w++)
+  {
+    words[w] &= other.words[w];
+  }
+  words.resize(shared);
+  return *this;
+}
+
+/**
+ * @brief Adds every territory of another set to this set.
+ *
+ * @param other The set to merge in.
+ * @return Reference to this set.
+ */
+TerritorySet &TerritorySet::operator|=(const TerritorySet &other)
+{
+  if (other.words.size() > words.size())
+  {
+    words.resize(other.words.size(), 0);
+  }
+  for (int w = 0; w < (int)other.words.size(); w++)
+  {
+    words[w] |= other.words[w];
+  }
+  return *this;
+}
+
+/**
+ * @brief Removes every territory of another set from this set.
+ *
+ * @param other The set to subtract.
+ * @return Reference to this set.
+ */
+TerritorySet &TerritorySet::andNot(const TerritorySet &other)
+{
+  int shared = (int)std::min(words.size(), other.words.size());
+  for (int w = 0; w < shared; w++)
+  {
+    words[w] &= ~other.words[w];
+  }
+  return *this;
+}
+
+/**
+ * @brief Counts the territories present in both this set and another, without building the intersection.
+ *
+ * @param other The set to intersect with.
+ * @return The size of the intersection.
+ */
+int TerritorySet::countAnd(const TerritorySet &other) const
+{
+  int shared = (int)std::min(words.size(), other.words.size());
+  int total = 0;
+  for (int w = 0; w < shared; w++)
+  {
+    total += __builtin_popcountll(words[w] & other.words[w]);
+  }
+  return total;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Dense bitset over territory IDs.
+ *
+ * Bit i is set when the territory with ID i belongs to the set. Binary operations work on whole 64-bit words,
+ * so set algebra over a map of N territories costs O(N/64) and is auto-vectorized by the compiler where SIMD is available.
+ * Sets of different lengths can be combined; missing words are treated as zero.
+ */
+class TerritorySet
+{
+private:
+  std::vector<uint64_t> words;
+
+public:
+  // Constructors
+  TerritorySet() = default;
+  explicit TerritorySet(int size);
+
+  // Single element operations
+  void set(int id);
+  void reset(int id);
+  bool test(int id) const;
+  void clear();
+
+  // Queries
+  int count() const;
+  bool any() const;
+  int wordCount() const;
+
+  // Set algebra
+  TerritorySet &operator&=(const TerritorySet &other);
+  TerritorySet &operator|=(const TerritorySet &other);
+  TerritorySet &andNot(const TerritorySet &other);
+  int countAnd(const TerritorySet &other) const;
+
+  /**
+   * @brief Calls fn(id) for every set bit, in increasing ID order.
+   */
+  template <typename Fn>
+  void forEach(Fn fn) const
+  {
+    for (int w = 0; w < (int)words.size(); w++)
+    {
+      uint64_t word = words[w];
+      while (word)
+      {
+        fn(w * 64 + __builtin_ctzll(word));
+        word &= word - 1;
+      }
+    }
+  }
+
+private:
+  void ensureWord(int w);
+};
@@ -0,0 +1,625 @@
+#include "TerritoryStore.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define TERRITORY_STORE_AVX2 1
+#endif
+
+bool TerritoryStore::vectorized = TerritoryStore::cpuHasAvx2();
+
+/**
+ * @brief Gets the Zobrist key of a territory being owned by a player.
+ *
+ * @param id The ID of the territory.
+ * @param owner The ID of the owner, or NEUTRAL.
+ * @return The key.
+ */
+static uint64_t ownerKey(int id, int32_t owner)
+{
+  return TerritoryStore::mixKey(((uint64_t)(uint32_t)id << 32) | (uint32_t)(owner + 1));
+}
+
+/**
+ * @brief Gets the Zobrist key of a territory holding a number of armies.
+ *
+ * @param id The ID of the territory.
+ * @param armies The number of armies.
+ * @return The key of the army bucket.
+ */
+static uint64_t armyKey(int id, int32_t armies)
+{
+  return TerritoryStore::mixKey(((uint64_t)(uint32_t)id << 32) | (1u << 31) | (uint32_t)TerritoryStore::armyBucket(armies));
+}
+
+#ifdef TERRITORY_STORE_AVX2
+/**
+ * @brief Adds up the eight lanes of a vector.
+ *
+ * @param v The vector.
+ * @return The sum of its lanes.
+ */
+__attribute__((target("avx2"))) static int horizontalSum(__m256i v)
+{
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(sum);
+}
+
+/**
+ * @brief AVX2 kernel counting the territories of an owner and summing their armies.
+ *
+ * @param o The owner array.
+ * @param a The army array, or nullptr to only count.
+ * @param n The number of territories.
+ * @param ownerId The ID of the owner.
+ * @param count Receives the number of territories.
+ * @param sum Receives the total number of armies.
+ */
+__attribute__((target("avx2"))) static void tallyOwnerAvx2(const int32_t *o, const int32_t *a, int n, int32_t ownerId,
+                                                            int &count, int &sum)
+{
+  __m256i key = _mm256_set1_epi32(ownerId);
+  __m256i counts = _mm256_setzero_si256();
+  __m256i sums = _mm256_setzero_si256();
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    // Matching lanes are all ones, i.e. -1
+    __m256i match = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(o + i)), key);
+    counts = _mm256_sub_epi32(counts, match);
+    if (a)
+    {
+      sums = _mm256_add_epi32(sums, _mm256_and_si256(match, _mm256_loadu_si256((const __m256i *)(a + i))));
+    }
+  }
+  count = horizontalSum(counts);
+  sum = horizontalSum(sums);
+  for (; i < n; i++)
+  {
+    count += o[i] == ownerId;
+    sum += a && o[i] == ownerId ? a[i] : 0;
+  }
+}
+
+/**
+ * @brief AVX2 kernel counting territories and summing armies for up to eight owners in one pass.
+ *
+ * @param o The owner array.
+ * @param a The army array.
+ * @param n The number of territories.
+ * @param numOwners The number of owner IDs, at most 8.
+ * @param counts Receives the number of territories per owner ID.
+ * @param sums Receives the total number of armies per owner ID.
+ */
+__attribute__((target("avx2"))) static void tallyOwnersAvx2(const int32_t *o, const int32_t *a, int n, int numOwners,
+                                                             int *counts, int *sums)
+{
+  __m256i countAcc[8], sumAcc[8];
+  for (int p = 0; p < numOwners; p++)
+  {
+    countAcc[p] = _mm256_setzero_si256();
+    sumAcc[p] = _mm256_setzero_si256();
+  }
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    __m256i owners = _mm256_loadu_si256((const __m256i *)(o + i));
+    __m256i armies = _mm256_loadu_si256((const __m256i *)(a + i));
+    for (int p = 0; p < numOwners; p++)
+    {
+      __m256i match = _mm256_cmpeq_epi32(owners, _mm256_set1_epi32(p));
+      countAcc[p] = _mm256_sub_epi32(countAcc[p], match);
+      sumAcc[p] = _mm256_add_epi32(sumAcc[p], _mm256_and_si256(match, armies));
+    }
+  }
+  for (int p = 0; p < numOwners; p++)
+  {
+    counts[p] = horizontalSum(countAcc[p]);
+    sums[p] = horizontalSum(sumAcc[p]);
+  }
+  for (; i < n; i++)
+  {
+    if (o[i] >= 0 && o[i] < numOwners)
+    {
+      counts[o[i]]++;
+      sums[o[i]] += a[i];
+    }
+  }
+}
+
+/**
+ * @brief AVX2 kernel adding armies to every territory of an owner.
+ * Lanes whose army bucket may have changed (a count below 8, or a new highest bit) are flagged in the vector loop
+ * and fixed up in the hash one by one, so the hash costs nothing while counts stay within their power of two.
+ *
+ * @param o The owner array.
+ * @param a The army array.
+ * @param n The number of territories.
+ * @param ownerId The ID of the owner.
+ * @param amount The number of armies to add to each territory.
+ * @param hash The army hash to update.
+ */
+__attribute__((target("avx2"))) static void addWhereOwnerAvx2(const int32_t *o, int32_t *a, int n, int32_t ownerId,
+                                                               int32_t amount, uint64_t &hash)
+{
+  __m256i key = _mm256_set1_epi32(ownerId);
+  __m256i add = _mm256_set1_epi32(amount);
+  __m256i eight = _mm256_set1_epi32(8);
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    __m256i match = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(o + i)), key);
+    __m256i before = _mm256_loadu_si256((const __m256i *)(a + i));
+    __m256i after = _mm256_add_epi32(before, _mm256_and_si256(match, add));
+    _mm256_storeu_si256((__m256i *)(a + i), after);
+
+    // Two counts of 8 or more share a bucket when they have the same highest bit, i.e. (x ^ y) <= (x & y)
+    __m256i small = _mm256_cmpgt_epi32(eight, _mm256_min_epi32(before, after));
+    __m256i newBit = _mm256_cmpgt_epi32(_mm256_xor_si256(before, after), _mm256_and_si256(before, after));
+    __m256i flagged = _mm256_and_si256(match, _mm256_or_si256(small, newBit));
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(flagged));
+    while (mask)
+    {
+      int lane = __builtin_ctz(mask);
+      mask &= mask - 1;
+      int32_t oldArmies = a[i + lane] - amount;
+      if (TerritoryStore::armyBucket(oldArmies) != TerritoryStore::armyBucket(a[i + lane]))
+      {
+        hash ^= armyKey(i + lane, oldArmies) ^ armyKey(i + lane, a[i + lane]);
+      }
+    }
+  }
+  for (; i < n; i++)
+  {
+    if (o[i] == ownerId)
+    {
+      int32_t oldArmies = a[i];
+      a[i] += amount;
+      if (TerritoryStore::armyBucket(oldArmies) != TerritoryStore::armyBucket(a[i]))
+      {
+        hash ^= armyKey(i, oldArmies) ^ armyKey(i, a[i]);
+      }
+    }
+  }
+}
+#endif
+
+/**
+ * @brief Appends a territory to the store.
+ *
+ * @param _armies The number of armies in the territory.
+ * @param _owner The ID of the owning player, or NEUTRAL.
+ * @param _continent The ID of the continent, or -1 if unknown.
+ * @return The ID of the new territory.
+ */
+int TerritoryStore::add(int32_t _armies, int32_t _owner, int32_t _continent)
+{
+  int id = (int)armies.size();
+  armies.push_back(_armies);
+  owner.push_back(_owner);
+  continent.push_back(_continent);
+  ownerHash ^= ownerKey(id, _owner);
+  armyHash ^= armyKey(id, _armies);
+  return id;
+}
+
+/**
+ * @brief Removes every territory from the store.
+ */
+void TerritoryStore::clear()
+{
+  armies.clear();
+  owner.clear();
+  continent.clear();
+  ownerHash = 0;
+  armyHash = 0;
+  changed.clear();
+  isChanged.clear();
+}
+
+/**
+ * @brief Adds a territory to the changes, once.
+ *
+ * @param id The ID of the territory.
+ */
+void TerritoryStore::markChanged(int id)
+{
+  if ((size_t)id >= isChanged.size())
+  {
+    isChanged.resize(armies.size(), 0);
+  }
+  if (!isChanged[id])
+  {
+    isChanged[id] = 1;
+    changed.push_back(id);
+  }
+}
+
+/**
+ * @brief Sets the number of armies in a territory.
+ *
+ * @param id The ID of the territory.
+ * @param _armies The new number of armies.
+ */
+void TerritoryStore::setArmies(int id, int32_t _armies)
+{
+  if (armyBucket(armies[id]) != armyBucket(_armies))
+  {
+    armyHash ^= armyKey(id, armies[id]) ^ armyKey(id, _armies);
+  }
+  armies[id] = _armies;
+  if (tracking)
+  {
+    markChanged(id);
+  }
+}
+
+/**
+ * @brief Sets the owner of a territory.
+ *
+ * @param id The ID of the territory.
+ * @param _owner The ID of the new owner, or NEUTRAL.
+ */
+void TerritoryStore::setOwner(int id, int32_t _owner)
+{
+  ownerHash ^= ownerKey(id, owner[id]) ^ ownerKey(id, _owner);
+  owner[id] = _owner;
+  if (tracking)
+  {
+    markChanged(id);
+  }
+}
+
+/**
+ * @brief Gets the number of territories in the store.
+ *
+ * @return The number of territories.
+ */
+int TerritoryStore::size() const
+{
+  return (int)armies.size();
+}
+
+/**
+ * @brief Counts the territories owned by a player.
+ *
+ * @param ownerId The ID of the player, or NEUTRAL.
+ * @return The number of territories owned.
+ */
+int TerritoryStore::countByOwner(int32_t ownerId) const
+{
+#ifdef TERRITORY_STORE_AVX2
+  if (vectorized)
+  {
+    int count, sum;
+    tallyOwnerAvx2(owner.data(), nullptr, size(), ownerId, count, sum);
+    return count;
+  }
+#endif
+  const int32_t *o = owner.data();
+  int n = size();
+  int total = 0;
+  for (int i = 0; i < n; i++)
+  {
+    total += o[i] == ownerId;
+  }
+  return total;
+}
+
+/**
+ * @brief Sums the armies on every territory owned by a player.
+ *
+ * @param ownerId The ID of the player, or NEUTRAL.
+ * @return The total number of armies.
+ */
+int TerritoryStore::sumArmiesByOwner(int32_t ownerId) const
+{
+#ifdef TERRITORY_STORE_AVX2
+  if (vectorized)
+  {
+    int count, sum;
+    tallyOwnerAvx2(owner.data(), armies.data(), size(), ownerId, count, sum);
+    return sum;
+  }
+#endif
+  const int32_t *o = owner.data();
+  const int32_t *a = armies.data();
+  int n = size();
+  int total = 0;
+  for (int i = 0; i < n; i++)
+  {
+    total += o[i] == ownerId ? a[i] : 0;
+  }
+  return total;
+}
+
+/**
+ * @brief Counts the territories of every player in a single pass.
+ *
+ * @param numOwners The number of player IDs in use.
+ * @return Territory counts indexed by player ID. Neutral territories are not counted.
+ */
+std::vector<int> TerritoryStore::countsByOwner(int numOwners) const
+{
+  std::vector<int> counts(numOwners, 0);
+#ifdef TERRITORY_STORE_AVX2
+  if (vectorized && numOwners <= 8)
+  {
+    std::vector<int> sums(numOwners, 0);
+    tallyOwnersAvx2(owner.data(), armies.data(), size(), numOwners, counts.data(), sums.data());
+    return counts;
+  }
+#endif
+  for (auto o : owner)
+  {
+    if (o >= 0 && o < numOwners)
+    {
+      counts[o]++;
+    }
+  }
+  return counts;
+}
+
+/**
+ * @brief Sums the armies of every player in a single pass.
+ *
+ * @param numOwners The number of player IDs in use.
+ * @return Army totals indexed by player ID. Neutral territories are not counted.
+ */
+std::vector<int> TerritoryStore::armiesByOwner(int numOwners) const
+{
+  std::vector<int> sums(numOwners, 0);
+#ifdef TERRITORY_STORE_AVX2
+  if (vectorized && numOwners <= 8)
+  {
+    std::vector<int> counts(numOwners, 0);
+    tallyOwnersAvx2(owner.data(), armies.data(), size(), numOwners, counts.data(), sums.data());
+    return sums;
+  }
+#endif
+  int n = size();
+  for (int i = 0; i < n; i++)
+  {
+    int32_t o = owner[i];
+    if (o >= 0 && o < numOwners)
+    {
+      sums[o] += armies[i];
+    }
+  }
+  return sums;
+}
+
+/**
+ * @brief Counts the territories a player owns on each continent in a single pass.
+ *
+ * @param ownerId The ID of the player.
+ * @param numContinents The number of continent IDs in use.
+ * @return Territory counts indexed by continent ID.
+ */
+std::vector<int> TerritoryStore::countsByContinentForOwner(int32_t ownerId, int numContinents) const
+{
+  std::vector<int> counts(numContinents, 0);
+  int n = size();
+  for (int i = 0; i < n; i++)
+  {
+    int32_t c = continent[i];
+    if (owner[i] == ownerId && c >= 0 && c < numContinents)
+    {
+      counts[c]++;
+    }
+  }
+  return counts;
+}
+
+/**
+ * @brief Counts the territories every player owns on each continent in a single pass.
+ *
+ * @param numOwners The number of player IDs in use.
+ * @param numContinents The number of continent IDs in use.
+ * @return Territory counts indexed by ownerId * numContinents + continentId.
+ */
+std::vector<int> TerritoryStore::countsByOwnerAndContinent(int numOwners, int numContinents) const
+{
+  std::vector<int> counts((size_t)numOwners * numContinents, 0);
+  int n = size();
+  for (int i = 0; i < n; i++)
+  {
+    int32_t o = owner[i];
+    int32_t c = continent[i];
+    if (o >= 0 && o < numOwners && c >= 0 && c < numContinents)
+    {
+      counts[(size_t)o * numContinents + c]++;
+    }
+  }
+  return counts;
+}
+
+/**
+ * @brief Gets the Zobrist hash of the owner of every territory. Kept up to date on every write, so this is O(1).
+ *
+ * @return The hash of the owner array.
+ */
+uint64_t TerritoryStore::ownershipHash() const
+{
+  return ownerHash;
+}
+
+/**
+ * @brief Gets the Zobrist hash of the owners and bucketed army counts of every territory.
+ *
+ * @return The hash of the territory state.
+ */
+uint64_t TerritoryStore::hash() const
+{
+  return ownerHash ^ armyHash;
+}
+
+/**
+ * @brief Recomputes the hash of the territory state from scratch, to verify the incremental one.
+ *
+ * @return The same value as hash() when the store was only written through its setters.
+ */
+uint64_t TerritoryStore::computeHash() const
+{
+  uint64_t full = 0;
+  for (int i = 0; i < size(); i++)
+  {
+    full ^= ownerKey(i, owner[i]) ^ armyKey(i, armies[i]);
+  }
+  return full;
+}
+
+/**
+ * @brief Groups army counts for hashing: 0 to 7 are kept exact, larger counts share a bucket per power of two.
+ * Small armies decide battles, while 40 and 41 armies are the same position for repetition purposes.
+ *
+ * @param _armies The number of armies.
+ * @return The bucket of the army count.
+ */
+int TerritoryStore::armyBucket(int32_t _armies)
+{
+  if (_armies < 8)
+  {
+    return _armies < 0 ? 0 : _armies;
+  }
+  // 8..15 -> 8, 16..31 -> 9, ...
+  return 8 + (28 - __builtin_clz((uint32_t)_armies));
+}
+
+/**
+ * @brief Mixes a 64-bit value into a well distributed key (splitmix64 finalizer).
+ * Keys are derived on the fly from (territory, feature, value), so no random key tables are stored.
+ *
+ * @param x The value to mix.
+ * @return The mixed key.
+ */
+uint64_t TerritoryStore::mixKey(uint64_t x)
+{
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief Adds armies to every territory owned by a player.
+ *
+ * @param ownerId The ID of the player.
+ * @param amount The number of armies to add to each territory.
+ */
+void TerritoryStore::addArmiesWhereOwner(int32_t ownerId, int32_t amount)
+{
+  if (amount == 0)
+  {
+    return;
+  }
+#ifdef TERRITORY_STORE_AVX2
+  if (vectorized)
+  {
+    addWhereOwnerAvx2(owner.data(), armies.data(), size(), ownerId, amount, armyHash);
+    if (tracking)
+    {
+      for (int i = 0; i < size(); i++)
+      {
+        if (owner[i] == ownerId)
+        {
+          markChanged(i);
+        }
+      }
+    }
+    return;
+  }
+#endif
+  const int32_t *o = owner.data();
+  int32_t *a = armies.data();
+  int n = size();
+  for (int i = 0; i < n; i++)
+  {
+    if (o[i] == ownerId)
+    {
+      setArmies(i, a[i] + amount);
+    }
+  }
+}
+
+/**
+ * @brief Starts or stops listing the territories written through the setters and bulk updates.
+ * Either way, the changes listed so far are cleared.
+ *
+ * @param enabled Whether to track changes.
+ */
+void TerritoryStore::setTracking(bool enabled)
+{
+  tracking = enabled;
+  changed.clear();
+  isChanged.assign(enabled ? armies.size() : 0, 0);
+}
+
+/**
+ * @brief Checks whether changes are being tracked.
+ *
+ * @return True if changes are tracked, false otherwise.
+ */
+bool TerritoryStore::isTracking() const
+{
+  return tracking;
+}
+
+/**
+ * @brief Gets the territories written since the changes were last cleared, in the order they were first written.
+ *
+ * @return The IDs of the changed territories.
+ */
+const std::vector<int32_t> &TerritoryStore::getChanged() const
+{
+  return changed;
+}
+
+/**
+ * @brief Clears the list of changed territories.
+ */
+void TerritoryStore::clearChanged()
+{
+  for (int32_t id : changed)
+  {
+    isChanged[id] = 0;
+  }
+  changed.clear();
+}
+
+/**
+ * @brief Checks whether the CPU running the program supports AVX2.
+ *
+ * @return True if the AVX2 kernels can run, false otherwise.
+ */
+bool TerritoryStore::cpuHasAvx2()
+{
+#ifdef TERRITORY_STORE_AVX2
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief Chooses between the AVX2 kernels and the scalar loops for the bulk operations, e.g. to compare them.
+ * The AVX2 kernels are only used when the CPU supports them.
+ *
+ * @param enabled Whether to use the AVX2 kernels.
+ */
+void TerritoryStore::setVectorized(bool enabled)
+{
+  vectorized = enabled && cpuHasAvx2();
+}
+
+/**
+ * @brief Checks whether the bulk operations use the AVX2 kernels.
+ *
+ * @return True if the AVX2 kernels are used, false if the scalar loops are.
+ */
+bool TerritoryStore::isVectorized()
+{
+  return vectorized;
+}
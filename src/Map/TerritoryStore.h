@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Hot per-territory game state stored as parallel arrays indexed by territory ID.
+ *
+ * Territory objects keep their cold data (name, coordinates, adjacency) and read/write armies, owner and continent
+ * through this store once they are added to a map. Keeping the state contiguous lets whole-map passes run as
+ * linear scans that the compiler can vectorize.
+ *
+ * The store also keeps a 64-bit Zobrist hash of the owners and bucketed army counts, updated in O(1) on every write.
+ * The arrays may be read directly, but armies and owners must be written through setArmies/setOwner (or the bulk
+ * updates) so the hash stays in sync.
+ *
+ * While change tracking is on, the store also lists the territories written since the changes were last cleared, so
+ * a replay can record what an order changed without comparing the whole map.
+ *
+ * The per-owner bulk queries and updates have AVX2 kernels, picked at run time when the CPU supports AVX2, and
+ * scalar fallbacks that give the same results.
+ */
+class TerritoryStore
+{
+private:
+  // Zobrist hashes of the owner array and of the bucketed army counts
+  uint64_t ownerHash = 0;
+  uint64_t armyHash = 0;
+
+  // Territories written since the changes were last cleared, and a flag per territory, while tracking changes
+  bool tracking = false;
+  std::vector<int32_t> changed;
+  std::vector<char> isChanged;
+
+  // Whether the bulk operations use the AVX2 kernels
+  static bool vectorized;
+
+  void markChanged(int id);
+
+public:
+  // Owner ID used for territories that belong to no player
+  static const int32_t NEUTRAL = -1;
+
+  std::vector<int32_t> armies;
+  std::vector<int32_t> owner;
+  std::vector<int32_t> continent;
+
+  // Adders
+  int add(int32_t armies, int32_t owner, int32_t continent);
+  void clear();
+
+  // Setters
+  void setArmies(int id, int32_t armies);
+  void setOwner(int id, int32_t owner);
+
+  // Getters
+  int size() const;
+
+  // Bulk Queries
+  int countByOwner(int32_t ownerId) const;
+  int sumArmiesByOwner(int32_t ownerId) const;
+  std::vector<int> countsByOwner(int numOwners) const;
+  std::vector<int> armiesByOwner(int numOwners) const;
+  std::vector<int> countsByContinentForOwner(int32_t ownerId, int numContinents) const;
+  std::vector<int> countsByOwnerAndContinent(int numOwners, int numContinents) const;
+
+  // Hashing
+  uint64_t ownershipHash() const;
+  uint64_t hash() const;
+  uint64_t computeHash() const;
+  static int armyBucket(int32_t armies);
+  static uint64_t mixKey(uint64_t x);
+
+  // Bulk Updates
+  void addArmiesWhereOwner(int32_t ownerId, int32_t amount);
+
+  // Change Tracking
+  void setTracking(bool enabled);
+  bool isTracking() const;
+  const std::vector<int32_t> &getChanged() const;
+  void clearChanged();
+
+  // SIMD Dispatch
+  static bool cpuHasAvx2();
+  static void setVectorized(bool enabled);
+  static bool isVectorized();
+};
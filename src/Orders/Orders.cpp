@@ -1,5 +1,6 @@
 #include <iomanip> // To format output.
 #include <cstdlib>
+#include <algorithm>
 #include "Orders.h"
 #include "Map/Map.h"
 #include "Player/Player.h"
@@ -361,6 +362,36 @@ std::string Advance::getLabel() const
   return label;
 }
 
+/**
+ * @brief Gets the territory the armies leave.
+ *
+ * @return The source territory.
+ */
+Territory *Advance::getSource() const
+{
+  return source;
+}
+
+/**
+ * @brief Gets the territory the order targets.
+ *
+ * @return The target territory.
+ */
+Territory *Advance::getTarget() const
+{
+  return target;
+}
+
+/**
+ * @brief Gets the number of armies the order moves.
+ *
+ * @return The number of armies.
+ */
+int Advance::getAmount() const
+{
+  return amount;
+}
+
 /**
  * @brief Static member variable representing the label of the Advance order.
  */
@@ -381,8 +412,7 @@ bool Advance::validate() const
          << endl;
     return false;
   }
-  else if (!(std::find(source->getAdjacentTerritories()->begin(), source->getAdjacentTerritories()->end(), target) !=
-             source->getAdjacentTerritories()->end()))
+  else if (!source->isAdjacent(target))
   {
     cout << "The target territory is not adjacent to the source territory!\n"
          << endl;
@@ -398,6 +428,7 @@ bool Advance::validate() const
   {
     cout << "Please enter a value that is at least 1 for this order\n"
          << endl;
+    return false;
   }
   cout << "Your order has been validated!\n"
        << endl;
@@ -473,12 +504,12 @@ void Advance::attackSimulation(Territory *pSource, Territory *pTarget, Player *p
   int successAttack = 0;
   int successDefend = 0;
 
+  // Rolls come from the game generator, so a seeded game fights the same battles
+  std::mt19937 &rng = pCurrentPlayer->getGameInstance()->getRng();
+  std::uniform_int_distribution<std::mt19937::result_type> range(0, 100);
+
   for (int i = 1; i <= army; i++) // Attacking Phase
   {
-    std::random_device dev;
-    std::mt19937 rng(dev());
-    std::uniform_int_distribution<std::mt19937::result_type> range(0, 100);
-
     int roll = (int)range(rng) % 100 + 1;
     if (roll <= 60)
     {
@@ -488,10 +519,6 @@ void Advance::attackSimulation(Territory *pSource, Territory *pTarget, Player *p
 
   for (int i = 1; i <= pTarget->getArmies(); i++) // Defending Phase
   {
-    std::random_device dev;
-    std::mt19937 rng(dev());
-    std::uniform_int_distribution<std::mt19937::result_type> range(0, 100);
-
     int roll = (int)range(rng) % 100 + 1;
 
     if (roll <= 70)
@@ -513,7 +540,7 @@ void Advance::attackSimulation(Territory *pSource, Territory *pTarget, Player *p
     pCurrentPlayer->addTerritory(*pTarget); // territory added to the player list
 
     // give the player an army card from the deck (if there is one)
-    if (!pCurrentPlayer->getGameInstance()->getDeck()->getDeckCards()->empty())
+    if (!pCurrentPlayer->getGameInstance()->getDeck()->empty())
     {
       cout << pCurrentPlayer->getName() << " has won a card" << endl;
       pCurrentPlayer->getGameInstance()->getDeck()->draw(*pCurrentPlayer->getHand());
@@ -598,6 +625,36 @@ std::string Airlift::getLabel() const
   return label;
 }
 
+/**
+ * @brief Gets the territory the armies leave.
+ *
+ * @return The source territory.
+ */
+Territory *Airlift::getSource() const
+{
+  return source;
+}
+
+/**
+ * @brief Gets the territory the order targets.
+ *
+ * @return The target territory.
+ */
+Territory *Airlift::getTarget() const
+{
+  return target;
+}
+
+/**
+ * @brief Gets the number of armies the order moves.
+ *
+ * @return The number of armies.
+ */
+int Airlift::getAmount() const
+{
+  return amount;
+}
+
 /**
  * @brief Stream insertion operator for Airlift class.
  *        Outputs a string indicating an Airlift order.
@@ -628,11 +685,13 @@ bool Airlift::validate() const
   {
     cout << "You do not have this many armies in this territory!\n"
          << endl;
+    return false;
   }
   else if (amount < 1)
   {
     cout << "Please enter a value that is at least 1 for this order\n"
          << endl;
+    return false;
   }
   cout << "Your order has been validated!\n"
        << endl;
@@ -737,6 +796,16 @@ std::string Blockade::getLabel() const
   return label;
 }
 
+/**
+ * @brief Gets the territory the order targets.
+ *
+ * @return The target territory.
+ */
+Territory *Blockade::getTarget() const
+{
+  return target;
+}
+
 /**
  * @brief Stream insertion operator for Blockade class.
  *        Outputs a string indicating a Blockade order.
@@ -861,6 +930,16 @@ std::string Bomb::getLabel() const
   return label;
 }
 
+/**
+ * @brief Gets the territory the order targets.
+ *
+ * @return The target territory.
+ */
+Territory *Bomb::getTarget() const
+{
+  return target;
+}
+
 /**
  * @brief Stream insertion operator for Bomb class.
  *        Outputs a string indicating a Bomb order.
@@ -997,6 +1076,26 @@ std::string Deploy::getLabel() const
   return label;
 }
 
+/**
+ * @brief Gets the territory the order targets.
+ *
+ * @return The target territory.
+ */
+Territory *Deploy::getTarget() const
+{
+  return target;
+}
+
+/**
+ * @brief Gets the number of armies the order moves.
+ *
+ * @return The number of armies.
+ */
+int Deploy::getAmount() const
+{
+  return amount;
+}
+
 /**
  * @brief Stream insertion operator for Deploy class.
  *        Outputs a string indicating a Deploy order.
@@ -1018,27 +1117,39 @@ bool Deploy::validate() const
 {
   std::cout << "-> Deploy order validation check" << std::endl;
 
-  if (target->getPlayer() != currentPlayer)
+  const char *reason = invalidReason(currentPlayer->getReinforcementPool());
+  if (reason)
   {
-    cout << "You do not own this territory!\n"
+    cout << reason << "\n"
          << endl;
     return false;
   }
-  else if (amount > currentPlayer->getReinforcementPool())
+  cout << "Your order has been validated!\n"
+       << endl;
+  return true;
+}
+
+/**
+ * @brief Checks the Deploy order without printing anything.
+ *
+ * @param reinforcementPool The armies the player has left to deploy when the order runs.
+ * @return The reason the order is invalid, or nullptr if it is valid.
+ */
+const char *Deploy::invalidReason(int reinforcementPool) const
+{
+  if (target->getPlayer() != currentPlayer)
+  {
+    return "You do not own this territory!";
+  }
+  else if (amount > reinforcementPool)
   {
-    cout << "You do not have this many armies in the reinforcement pool!\n"
-         << endl;
-    return false;
+    return "You do not have this many armies in the reinforcement pool!";
   }
   else if (amount < 1)
   {
-    cout << "Please enter a value that is at least 1 for this order\n"
-         << endl;
-    return false;
+    return "Please enter a value that is at least 1 for this order";
   }
-  cout << "Your order has been validated!\n"
-       << endl;
-  return true;
+  return nullptr;
 }
 
 /**
@@ -1058,6 +1169,68 @@ void Deploy::execute()
   }
 }
 
+/**
+ * @brief Executes Deploy orders as one batch.
+ *        Deploys never change who owns a territory, so each order only depends on the earlier orders of its own
+ *        player through the reinforcement pool. The orders are checked in sequence against a running pool per
+ *        player, then the armies are added once per territory and the pools are charged once per player.
+ *
+ * @param orders The orders, in execution order.
+ * @return The number of orders that were valid and executed.
+ */
+int Deploy::executeBatch(const std::vector<Deploy *> &orders)
+{
+  std::vector<std::pair<Player *, int>> pools;
+  std::vector<std::pair<int, int>> armiesByTerritory;
+  std::vector<Deploy *> executed;
+
+  for (Deploy *order : orders)
+  {
+    auto pool = std::find_if(pools.begin(), pools.end(), [&](const std::pair<Player *, int> &entry)
+                             { return entry.first == order->currentPlayer; });
+    if (pool == pools.end())
+    {
+      pools.emplace_back(order->currentPlayer, order->currentPlayer->getReinforcementPool());
+      pool = pools.end() - 1;
+    }
+
+    const char *reason = order->invalidReason(pool->second);
+    if (reason)
+    {
+      cout << order->currentPlayer->getName() << ": " << reason << endl;
+      continue;
+    }
+    pool->second -= order->amount;
+    armiesByTerritory.emplace_back(order->target->getId(), order->amount);
+    executed.push_back(order);
+  }
+
+  // One write per territory
+  std::sort(armiesByTerritory.begin(), armiesByTerritory.end());
+  Map *map = orders.empty() ? nullptr : orders.front()->game->getMap();
+  for (size_t i = 0; i < armiesByTerritory.size();)
+  {
+    int id = armiesByTerritory[i].first;
+    int added = 0;
+    for (; i < armiesByTerritory.size() && armiesByTerritory[i].first == id; i++)
+    {
+      added += armiesByTerritory[i].second;
+    }
+    Territory *territory = map->getTerritoryById(id);
+    territory->setArmies(territory->getArmies() + added);
+  }
+  for (auto &pool : pools)
+  {
+    pool.first->removeArmies(pool.first->getReinforcementPool() - pool.second);
+  }
+
+  for (Deploy *order : executed)
+  {
+    order->Subject::notify(order);
+  }
+  return (int)executed.size();
+}
+
 /**
  * @brief Clones the Deploy order.
  *
@@ -1130,6 +1303,16 @@ std::string Negotiate::getLabel() const
   return label;
 }
 
+/**
+ * @brief Gets the player the negotiation is with.
+ *
+ * @return The target player.
+ */
+Player *Negotiate::getTargetPlayer() const
+{
+  return targetPlayer;
+}
+
 /**
  * @brief Validates the Negotiate order.
  *
@@ -1151,15 +1334,14 @@ bool Negotiate::validate() const
 
 /**
  * @brief Executes the Negotiate order.
- *        Adds both players to each other's friendly list.
+ *        Records the peace in the game's diplomacy table, for the rest of the round.
  */
 void Negotiate::execute()
 {
   if (validate())
   {
     std::cout << "Negotiate execution." << std::endl;
-    currentPlayer->addFriendly(targetPlayer);
-    targetPlayer->addFriendly(currentPlayer);
+    game->getDiplomacy()->makePeace(currentPlayer->getId(), targetPlayer->getId());
   }
   cout << "Negotiate has finished executing." << endl;
   Subject::notify(this);
@@ -152,6 +152,9 @@ private:
 public:
   Advance(GameEngine *game, Territory *src, Territory *dest, Player *player, int amount);
   ~Advance() override;
+  Territory *getSource() const;
+  Territory *getTarget() const;
+  int getAmount() const;
   std::string getLabel() const override;
   bool validate() const override;
   void execute() override;
@@ -181,6 +184,9 @@ private:
 public:
   Airlift(GameEngine *game, Territory *source, Territory *target, Player *player, int amount);
   ~Airlift() override;
+  Territory *getSource() const;
+  Territory *getTarget() const;
+  int getAmount() const;
   std::string getLabel() const override;
   bool validate() const override;
   void execute() override;
@@ -207,6 +213,7 @@ private:
 public:
   Blockade(GameEngine *game, Territory *target, Player *player);
   ~Blockade() override;
+  Territory *getTarget() const;
   std::string getLabel() const override;
   bool validate() const override;
   void execute() override;
@@ -233,6 +240,7 @@ private:
 public:
   Bomb(GameEngine *game, Territory *target, Player *player);
   ~Bomb() override;
+  Territory *getTarget() const;
   std::string getLabel() const override;
   bool validate() const override;
   void execute() override;
@@ -260,11 +268,31 @@ private:
 public:
   Deploy(GameEngine *game, Territory *target, Player *player, int amount);
   ~Deploy() override;
+  Territory *getTarget() const;
+  int getAmount() const;
   std::string getLabel() const override;
   bool validate() const override;
   void execute() override;
   std::string stringToLog() override;
 
+  /**
+   * @brief Checks the order without printing anything.
+   *
+   * @param reinforcementPool The armies the player has left to deploy when the order runs.
+   * @return The reason the order is invalid, or nullptr if it is valid.
+   */
+  const char *invalidReason(int reinforcementPool) const;
+
+  /**
+   * @brief Executes Deploy orders as one batch, with the same outcome as executing them one after the other.
+   * Orders are checked in sequence against a running reinforcement pool per player, then the armies are added
+   * once per territory and the orders are logged in their original order.
+   *
+   * @param orders The orders, in execution order. Nothing else may change the map while they run.
+   * @return The number of orders that were valid and executed.
+   */
+  static int executeBatch(const std::vector<Deploy *> &orders);
+
 private:
   const static std::string label;
   Order *clone() const override;
@@ -282,11 +310,11 @@ private:
   GameEngine *game;
   Player *currentPlayer;
   Player *targetPlayer;
-  std::vector<Player *> friendlyPlayers;
 
 public:
   Negotiate(GameEngine *game, Player *currentPlayer, Player *targetPlayer);
   ~Negotiate() override;
+  Player *getTargetPlayer() const;
   std::string getLabel() const override;
   bool validate() const override;
   void execute() override;
@@ -22,25 +22,25 @@ void testOrderExecution()
 
   // add cards to the gameEngine deck
   auto deck = gameEngine.getDeck();
-  deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
+  deck->addCardToDeck(CardType::CT_Reinforcement);
+  deck->addCardToDeck(CardType::CT_Reinforcement);
+  deck->addCardToDeck(CardType::CT_Reinforcement);
 
-  deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
+  deck->addCardToDeck(CardType::CT_Airlift);
+  deck->addCardToDeck(CardType::CT_Airlift);
+  deck->addCardToDeck(CardType::CT_Airlift);
 
-  deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
+  deck->addCardToDeck(CardType::CT_Diplomacy);
+  deck->addCardToDeck(CardType::CT_Diplomacy);
+  deck->addCardToDeck(CardType::CT_Diplomacy);
 
-  deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
+  deck->addCardToDeck(CardType::CT_Bomb);
+  deck->addCardToDeck(CardType::CT_Bomb);
+  deck->addCardToDeck(CardType::CT_Bomb);
 
-  deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-  deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
+  deck->addCardToDeck(CardType::CT_Blockade);
+  deck->addCardToDeck(CardType::CT_Blockade);
+  deck->addCardToDeck(CardType::CT_Blockade);
 
   // load a map before the game starts
   gameEngine.loadMap("../res/TestMap1_valid.map");
@@ -69,11 +69,11 @@ void testOrderExecution()
     player3->addTerritory(*t);
   }
 
-  player1->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-  player1->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-  player1->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-  player1->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-  player1->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
+  player1->getHand()->addToHand(CardType::CT_Reinforcement);
+  player1->getHand()->addToHand(CardType::CT_Blockade);
+  player1->getHand()->addToHand(CardType::CT_Bomb);
+  player1->getHand()->addToHand(CardType::CT_Diplomacy);
+  player1->getHand()->addToHand(CardType::CT_Airlift);
 
   // act
   gameEngine.mainGameLoop();
@@ -0,0 +1,527 @@
+#include "MonteCarloSearch.h"
+#include "Player.h"
+#include "PlayerStrategies.h"
+#include "Map/Map.h"
+#include "Map/TerritoryStore.h"
+#include "GameEngine/GameEngine.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+// Chance out of 65536 that a single attacking or defending army kills an opponent
+static const uint32_t ATTACK_KILL_CHANCE = 39322; // 60%
+static const uint32_t DEFEND_KILL_CHANCE = 45875; // 70%
+
+/**
+ * @brief Draws the next 64 random bits (splitmix64).
+ *
+ * @param rng The random number generator state.
+ * @return The random bits.
+ */
+static inline uint64_t nextRandom(uint64_t &rng)
+{
+  rng += 0x9E3779B97F4A7C15ULL;
+  return TerritoryStore::mixKey(rng);
+}
+
+/**
+ * @brief Draws a random number in [0, bound).
+ *
+ * @param rng The random number generator state.
+ * @param bound The exclusive upper bound, at least 1.
+ * @return The random number.
+ */
+static inline int nextBelow(uint64_t &rng, int bound)
+{
+  return (int)(((nextRandom(rng) >> 32) * (uint64_t)bound) >> 32);
+}
+
+/**
+ * @brief Counts how many of the given armies succeed, four rolls per random draw.
+ *
+ * @param armies The number of rolls.
+ * @param chance The chance of success out of 65536.
+ * @param rng The random number generator state.
+ * @return The number of successful rolls.
+ */
+static int countKills(int armies, uint32_t chance, uint64_t &rng)
+{
+  int kills = 0;
+  while (armies > 0)
+  {
+    uint64_t bits = nextRandom(rng);
+    for (int i = 0; i < 4 && armies > 0; i++, armies--)
+    {
+      kills += (uint32_t)(bits & 0xFFFF) < chance;
+      bits >>= 16;
+    }
+  }
+  return kills;
+}
+
+/**
+ * @brief Gets the number of territories on the board.
+ *
+ * @return The number of territories.
+ */
+int SimBoard::territoryCount() const
+{
+  return (int)continent.size();
+}
+
+/**
+ * @brief Gets the number of player IDs on the board, including eliminated players.
+ *
+ * @return The number of player IDs.
+ */
+int SimBoard::playerCount() const
+{
+  return (int)passive.size();
+}
+
+/**
+ * @brief Captures the game of a player and lists the moves it can make.
+ *
+ * @param player The searching player.
+ */
+MonteCarloSearch::MonteCarloSearch(Player *player) : playerId(player->getId())
+{
+  GameEngine *game = player->getGameInstance();
+  Map *map = game->getMap();
+  TerritoryStore *store = map->getStore();
+  int n = store->size();
+
+  board.adjacencyStart.reserve(n + 1);
+  board.adjacencyStart.push_back(0);
+  for (auto &territory : *map->getTerritories())
+  {
+    for (auto &adjacent : *territory->getAdjacentTerritories())
+    {
+      board.adjacency.push_back(adjacent->getId());
+    }
+    board.adjacencyStart.push_back((int32_t)board.adjacency.size());
+  }
+  board.continent = store->continent;
+  for (auto &continent : map->continents)
+  {
+    board.continentBonus.push_back(continent->getBonus());
+    board.continentSize.push_back((int32_t)continent->territories.size());
+  }
+
+  int playerIds = playerId + 1;
+  for (auto &p : *game->getPlayers())
+  {
+    playerIds = std::max(playerIds, p->getId() + 1);
+  }
+  // Player IDs without a player (removed players) never own anything, so they are never asked to move
+  board.passive.assign(playerIds, 1);
+  root.pool.assign(playerIds, 0);
+  for (auto &p : *game->getPlayers())
+  {
+    board.passive[p->getId()] = p->getStrategy() != nullptr && p->getStrategy()->isPassive();
+    root.pool[p->getId()] = std::max(p->getReinforcementPool() - p->getDeployedArmiesThisTurn(), 0);
+  }
+  root.armies = store->armies;
+  root.owner = store->owner;
+
+  TerritorySet attackable = player->getAttackableSet();
+  player->getTerritorySet().forEach([&](int source)
+                                    {
+    bool border = false;
+    for (int i = board.adjacencyStart[source]; i < board.adjacencyStart[source + 1]; i++)
+    {
+      int target = board.adjacency[i];
+      if (attackable.test(target))
+      {
+        if (!border)
+        {
+          SimAction deployOnly;
+          deployOnly.source = source;
+          actions.push_back(deployOnly);
+          border = true;
+        }
+        SimAction action;
+        action.source = source;
+        action.target = target;
+        actions.push_back(action);
+      }
+    } });
+}
+
+/**
+ * @brief Sets how many full rounds a rollout plays after the first one.
+ *
+ * @param rounds The number of rounds.
+ */
+void MonteCarloSearch::setRolloutDepth(int rounds)
+{
+  rolloutDepth = rounds;
+}
+
+/**
+ * @brief Gets the static board captured from the game.
+ *
+ * @return The board.
+ */
+const SimBoard &MonteCarloSearch::getBoard() const
+{
+  return board;
+}
+
+/**
+ * @brief Gets the state captured from the game.
+ *
+ * @return The root state.
+ */
+const SimState &MonteCarloSearch::getRoot() const
+{
+  return root;
+}
+
+/**
+ * @brief Gets the moves the player can make.
+ *
+ * @return The root actions.
+ */
+const std::vector<SimAction> &MonteCarloSearch::getActions() const
+{
+  return actions;
+}
+
+/**
+ * @brief Resolves an attack the way Advance::attackSimulation does: attackers leave the source, a conquered
+ * territory changes owner but keeps its army count, a beaten attack retreats, and emptied territories become neutral.
+ *
+ * @param state The state to update.
+ * @param source The attacking territory.
+ * @param target The attacked territory.
+ * @param armies The number of attacking armies.
+ * @param rng The random number generator state.
+ */
+void MonteCarloSearch::attack(SimState &state, int source, int target, int armies, uint64_t &rng) const
+{
+  int32_t attacker = state.owner[source];
+  state.armies[source] -= armies;
+
+  int attackKills = countKills(armies, ATTACK_KILL_CHANCE, rng);
+  int defendKills = countKills(state.armies[target], DEFEND_KILL_CHANCE, rng);
+  int remainingAttack = std::max(armies - defendKills, 0);
+  int remainingDefend = std::max(state.armies[target] - attackKills, 0);
+
+  if (remainingAttack > 0 && remainingDefend == 0)
+  {
+    state.owner[target] = attacker;
+  }
+  else
+  {
+    state.armies[source] += remainingAttack;
+    state.armies[target] = remainingDefend;
+  }
+
+  if (state.armies[source] == 0)
+  {
+    state.owner[source] = TerritoryStore::NEUTRAL;
+  }
+  if (state.armies[target] == 0)
+  {
+    state.owner[target] = TerritoryStore::NEUTRAL;
+  }
+}
+
+/**
+ * @brief Plays one round for every player with the rollout policy.
+ * As in the game, every order is decided on the state at the start of the round, all deployments execute before
+ * any attack, and an attack that lost its source on the way is dropped.
+ *
+ * @param state The state to update.
+ * @param reinforce Whether players receive their reinforcements first.
+ * @param skipPlayer A player that already moved this round, or -1.
+ * @param rng The random number generator state.
+ * @return The ID of a player owning every territory at the end of the round, or -1.
+ */
+int MonteCarloSearch::playRound(SimState &state, bool reinforce, int skipPlayer, uint64_t &rng) const
+{
+  static thread_local std::vector<int> counts, continentCounts, site, seen;
+  int n = board.territoryCount();
+  int players = board.playerCount();
+  int continents = (int)board.continentSize.size();
+
+  if (reinforce)
+  {
+    counts.assign(players, 0);
+    continentCounts.assign((size_t)players * continents, 0);
+    for (int t = 0; t < n; t++)
+    {
+      int32_t owner = state.owner[t];
+      if (owner >= 0)
+      {
+        counts[owner]++;
+        if (board.continent[t] >= 0)
+        {
+          continentCounts[(size_t)owner * continents + board.continent[t]]++;
+        }
+      }
+    }
+    for (int p = 0; p < players; p++)
+    {
+      if (counts[p] == 0)
+      {
+        continue;
+      }
+      int reinforcements = counts[p] / 3 * 3;
+      for (int c = 0; c < continents; c++)
+      {
+        if (continentCounts[(size_t)p * continents + c] == board.continentSize[c])
+        {
+          reinforcements += board.continentBonus[c];
+        }
+      }
+      state.pool[p] += std::max(reinforcements, 3);
+    }
+  }
+
+  // Pick a random border territory per player in one pass (reservoir sampling)
+  site.assign(players, -1);
+  seen.assign(players, 0);
+  for (int t = 0; t < n; t++)
+  {
+    int32_t owner = state.owner[t];
+    if (owner < 0 || owner == skipPlayer)
+    {
+      continue;
+    }
+    for (int i = board.adjacencyStart[t]; i < board.adjacencyStart[t + 1]; i++)
+    {
+      if (state.owner[board.adjacency[i]] != owner)
+      {
+        if (nextBelow(rng, ++seen[owner]) == 0)
+        {
+          site[owner] = t;
+        }
+        break;
+      }
+    }
+  }
+
+  for (int p = 0; p < players; p++)
+  {
+    if (site[p] != -1)
+    {
+      state.armies[site[p]] += state.pool[p];
+      state.pool[p] = 0;
+    }
+  }
+
+  for (int p = 0; p < players; p++)
+  {
+    int source = site[p];
+    if (source == -1 || board.passive[p] || state.owner[source] != p || state.armies[source] < 3)
+    {
+      continue;
+    }
+    int target = -1;
+    for (int i = board.adjacencyStart[source]; i < board.adjacencyStart[source + 1]; i++)
+    {
+      int neighbour = board.adjacency[i];
+      if (state.owner[neighbour] != p && (target == -1 || state.armies[neighbour] < state.armies[target]))
+      {
+        target = neighbour;
+      }
+    }
+    if (target != -1)
+    {
+      attack(state, source, target, state.armies[source] - 1, rng);
+    }
+  }
+
+  int32_t first = state.owner[0];
+  for (int t = 1; t < n; t++)
+  {
+    if (state.owner[t] != first)
+    {
+      return -1;
+    }
+  }
+  return first;
+}
+
+/**
+ * @brief Scores a state for the searching player.
+ *
+ * @param state The state to score.
+ * @return 1 for a win, 0 for a loss, otherwise the mean of the territory and army shares.
+ */
+double MonteCarloSearch::evaluate(const SimState &state) const
+{
+  int n = board.territoryCount();
+  int owned = 0;
+  long ownArmies = 0, totalArmies = 0;
+  for (int t = 0; t < n; t++)
+  {
+    if (state.owner[t] == TerritoryStore::NEUTRAL)
+    {
+      continue;
+    }
+    totalArmies += state.armies[t];
+    if (state.owner[t] == playerId)
+    {
+      owned++;
+      ownArmies += state.armies[t];
+    }
+  }
+  if (owned == 0)
+  {
+    return 0;
+  }
+  if (owned == n)
+  {
+    return 1;
+  }
+  return 0.5 * owned / n + 0.5 * (totalArmies > 0 ? (double)ownArmies / totalArmies : 0);
+}
+
+/**
+ * @brief Runs one rollout from the root after the given action.
+ * The action is applied, the other players answer in the same round, then up to rolloutDepth full rounds are played.
+ *
+ * @param action Index of the root action.
+ * @param state Scratch state, overwritten with the final state.
+ * @param rng The random number generator state.
+ * @return The value of the final state for the searching player.
+ */
+double MonteCarloSearch::rollout(int action, SimState &state, uint64_t &rng) const
+{
+  // Copy assignment reuses the scratch buffers, so a rollout does not allocate
+  state = root;
+  const SimAction &move = actions[action];
+  state.armies[move.source] += state.pool[playerId];
+  state.pool[playerId] = 0;
+  if (move.target != -1 && state.armies[move.source] > 1)
+  {
+    attack(state, move.source, move.target, state.armies[move.source] - 1, rng);
+  }
+
+  int winner = playRound(state, false, playerId, rng);
+  for (int round = 0; round < rolloutDepth && winner == -1; round++)
+  {
+    winner = playRound(state, true, -1, rng);
+  }
+  return evaluate(state);
+}
+
+/**
+ * @brief Searches until the time budget or the rollout limit runs out.
+ * Every worker runs UCB1 over the root actions with its own statistics, so workers never share memory
+ * while searching; their visits and values are summed once they are done.
+ *
+ * @param budgetMs The time budget in milliseconds, or 0 for no time limit.
+ * @param threads The number of worker threads, or 0 to use one per hardware thread.
+ * @param maxRollouts The maximum number of rollouts over all workers, or 0 for no limit.
+ * @param seed The seed of the workers' random number generators, or 0 to seed from std::random_device.
+ * @return The merged statistics and the chosen action.
+ * @throws std::runtime_error if neither a time budget nor a rollout limit is given.
+ */
+SearchResult MonteCarloSearch::search(int budgetMs, int threads, long maxRollouts, uint64_t seed) const
+{
+  if (budgetMs <= 0 && maxRollouts <= 0)
+  {
+    throw std::runtime_error("MonteCarloSearch::Error | A time budget or a rollout limit is needed");
+  }
+
+  SearchResult result;
+  int k = (int)actions.size();
+  result.visits.assign(k, 0);
+  result.values.assign(k, 0);
+  if (k == 0)
+  {
+    return result;
+  }
+  if (threads <= 0)
+  {
+    threads = std::max(1, (int)std::thread::hardware_concurrency());
+  }
+  if (seed == 0)
+  {
+    std::random_device device;
+    seed = ((uint64_t)device() << 32) | device();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto deadline = start + std::chrono::milliseconds(budgetMs);
+  std::atomic<long> claimed(0);
+  std::vector<std::vector<long>> visits(threads, std::vector<long>(k, 0));
+  std::vector<std::vector<double>> values(threads, std::vector<double>(k, 0));
+
+  auto worker = [&](int w)
+  {
+    uint64_t rng = seed + (uint64_t)w * 0xD1B54A32D192ED03ULL;
+    SimState state;
+    std::vector<long> &visit = visits[w];
+    std::vector<double> &value = values[w];
+    for (long total = 0;; total++)
+    {
+      if (maxRollouts > 0 && claimed++ >= maxRollouts)
+      {
+        break;
+      }
+      if (budgetMs > 0 && std::chrono::steady_clock::now() >= deadline)
+      {
+        break;
+      }
+
+      // Try every action once, then pick by upper confidence bound
+      int action = (int)(total % k);
+      if (total >= k)
+      {
+        double logTotal = std::log((double)total);
+        double bestBound = -1;
+        for (int a = 0; a < k; a++)
+        {
+          double bound = value[a] / visit[a] + exploration * std::sqrt(logTotal / visit[a]);
+          if (bound > bestBound)
+          {
+            bestBound = bound;
+            action = a;
+          }
+        }
+      }
+      value[action] += rollout(action, state, rng);
+      visit[action]++;
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (int w = 1; w < threads; w++)
+  {
+    pool.emplace_back(worker, w);
+  }
+  worker(0);
+  for (auto &thread : pool)
+  {
+    thread.join();
+  }
+
+  for (int w = 0; w < threads; w++)
+  {
+    for (int a = 0; a < k; a++)
+    {
+      result.visits[a] += visits[w][a];
+      result.values[a] += values[w][a];
+    }
+  }
+  for (int a = 0; a < k; a++)
+  {
+    result.rollouts += result.visits[a];
+    if (result.best == -1 || result.visits[a] > result.visits[result.best] ||
+        (result.visits[a] == result.visits[result.best] && result.values[a] > result.values[result.best]))
+    {
+      result.best = a;
+    }
+  }
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
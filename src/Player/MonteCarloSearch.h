@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+class Player;
+
+/**
+ * @brief Static part of a game as seen by the search: adjacency, continents and player behaviour.
+ *
+ * Adjacency is stored in compressed sparse row form: the neighbours of territory t are
+ * adjacency[adjacencyStart[t]] to adjacency[adjacencyStart[t + 1] - 1].
+ */
+struct SimBoard
+{
+  std::vector<int32_t> adjacencyStart;
+  std::vector<int32_t> adjacency;
+  // Continent ID per territory, or -1
+  std::vector<int32_t> continent;
+  // Bonus and number of territories per continent ID
+  std::vector<int32_t> continentBonus;
+  std::vector<int32_t> continentSize;
+  // Whether each player ID only deploys and never attacks
+  std::vector<char> passive;
+
+  /**
+   * @brief Gets the number of territories on the board.
+   *
+   * @return The number of territories.
+   */
+  int territoryCount() const;
+
+  /**
+   * @brief Gets the number of player IDs on the board, including eliminated players.
+   *
+   * @return The number of player IDs.
+   */
+  int playerCount() const;
+};
+
+/**
+ * @brief Compact copyable game state: armies and owner per territory ID, and armies left to deploy per player ID.
+ */
+struct SimState
+{
+  std::vector<int32_t> armies;
+  std::vector<int32_t> owner;
+  std::vector<int32_t> pool;
+};
+
+/**
+ * @brief A move of the searching player: deploy the whole pool on source, then attack target with all but one army.
+ * A target of -1 only deploys.
+ */
+struct SimAction
+{
+  int32_t source = -1;
+  int32_t target = -1;
+};
+
+/**
+ * @brief Outcome of a search.
+ */
+struct SearchResult
+{
+  // Index of the most visited action, or -1 if there was no action
+  int best = -1;
+  // Visits and summed rollout value per action, merged over every worker
+  std::vector<long> visits;
+  std::vector<double> values;
+  long rollouts = 0;
+  double seconds = 0;
+};
+
+/**
+ * @brief Monte Carlo search over the moves a player can make this turn.
+ *
+ * The search works on a SimState captured from the game, so a rollout only copies three small integer arrays.
+ * Each worker thread runs its own UCB1 bandit over the root actions (root parallelisation): it picks an action,
+ * applies it, lets every other player answer with the rollout policy and then plays a few full rounds. The visit
+ * counts of all workers are merged at the end and the most visited action is chosen.
+ *
+ * Rollout rounds follow the game rules: reinforcements (continent bonuses plus 3 per 3 territories, at least 3),
+ * a deployment on a random border territory, then an attack from there on the weakest neighbour with all but one
+ * army when at least 3 armies are there, resolved like an Advance order (60% per attacker, 70% per defender).
+ * Passive players only deploy.
+ */
+class MonteCarloSearch
+{
+private:
+  SimBoard board;
+  SimState root;
+  std::vector<SimAction> actions;
+  int playerId;
+  int rolloutDepth = 8;
+  double exploration = 1.4;
+
+  /**
+   * @brief Resolves an attack and updates the state the way Advance::attackSimulation does.
+   *
+   * @param state The state to update.
+   * @param source The attacking territory.
+   * @param target The attacked territory.
+   * @param armies The number of attacking armies.
+   * @param rng The random number generator state.
+   */
+  void attack(SimState &state, int source, int target, int armies, uint64_t &rng) const;
+
+  /**
+   * @brief Plays one round for every player with the rollout policy.
+   *
+   * @param state The state to update.
+   * @param reinforce Whether players receive their reinforcements first. The first round uses the pools as captured.
+   * @param skipPlayer A player that already moved this round, or -1.
+   * @param rng The random number generator state.
+   * @return The ID of a player owning every territory at the end of the round, or -1.
+   */
+  int playRound(SimState &state, bool reinforce, int skipPlayer, uint64_t &rng) const;
+
+  /**
+   * @brief Scores a state for the searching player.
+   *
+   * @param state The state to score.
+   * @return 1 for a win, 0 for a loss, otherwise the mean of the territory and army shares.
+   */
+  double evaluate(const SimState &state) const;
+
+public:
+  /**
+   * @brief Captures the game of a player and lists the moves it can make.
+   *
+   * @param player The searching player.
+   */
+  explicit MonteCarloSearch(Player *player);
+
+  /**
+   * @brief Sets how many full rounds a rollout plays after the first one.
+   *
+   * @param rounds The number of rounds.
+   */
+  void setRolloutDepth(int rounds);
+
+  /**
+   * @brief Gets the static board captured from the game.
+   *
+   * @return The board.
+   */
+  const SimBoard &getBoard() const;
+
+  /**
+   * @brief Gets the state captured from the game.
+   *
+   * @return The root state.
+   */
+  const SimState &getRoot() const;
+
+  /**
+   * @brief Gets the moves the player can make: one deploy-only move per border territory, and one attack per
+   * border territory and attackable neighbour.
+   *
+   * @return The root actions.
+   */
+  const std::vector<SimAction> &getActions() const;
+
+  /**
+   * @brief Runs one rollout from the root after the given action.
+   *
+   * @param action Index of the root action.
+   * @param state Scratch state, overwritten with the final state.
+   * @param rng The random number generator state.
+   * @return The value of the final state for the searching player.
+   */
+  double rollout(int action, SimState &state, uint64_t &rng) const;
+
+  /**
+   * @brief Searches until the time budget or the rollout limit runs out.
+   *
+   * @param budgetMs The time budget in milliseconds, or 0 for no time limit.
+   * @param threads The number of worker threads, or 0 to use one per hardware thread.
+   * @param maxRollouts The maximum number of rollouts over all workers, or 0 for no limit.
+   * @param seed The seed of the workers' random number generators, or 0 to seed from std::random_device.
+   * @return The merged statistics and the chosen action.
+   * @throws std::runtime_error if neither a time budget nor a rollout limit is given.
+   */
+  SearchResult search(int budgetMs, int threads = 0, long maxRollouts = 0, uint64_t seed = 0) const;
+};
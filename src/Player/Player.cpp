@@ -12,7 +12,7 @@
  * @param strategy The strategy chosen by the player.
  */
 Player::Player(GameEngine *game, Hand *cards, std::string name, const std::string &strategy)
-    : game(game), hand(cards), name(std::move(name)), reinforcementPool(0)
+    : game(game), hand(cards), name(game->getPlayerNames()->intern(name)), reinforcementPool(0)
 {
   orders = new OrdersList(game);
   game->addPlayer(this);
@@ -64,6 +64,7 @@ void Player::addTerritory(Territory &territory)
   }
   territory.setPlayer(this);
   territories.push_back(&territory);
+  territorySet.set(territory.getId());
 }
 
 /**
@@ -77,9 +78,10 @@ void Player::removeTerritory(Territory &territory)
   auto end = territories.end();
   for (auto it = territories.begin(); it != end; it++)
   {
-    if (territory.getName() == (*it)->getName())
+    if (&territory == *it)
     {
       territories.erase(it);
+      territorySet.reset(territory.getId());
       return;
     }
   }
@@ -112,6 +114,7 @@ Player &Player::operator=(const Player &other)
   this->orders = other.orders;
   this->hand = other.hand;
   this->territories = other.territories;
+  this->territorySet = other.territorySet;
   this->reinforcementPool = other.reinforcementPool;
   this->deployedArmiesThisTurn = other.deployedArmiesThisTurn;
   this->name = other.name;
@@ -150,6 +153,55 @@ std::vector<Territory *> *Player::getTerritories()
   return &territories;
 }
 
+/**
+ * @brief Get the territories owned by the player as a bitset.
+ *
+ * @return A reference to the bitset of owned territory IDs.
+ */
+const TerritorySet &Player::getTerritorySet() const
+{
+  return territorySet;
+}
+
+/**
+ * @brief Get the territories adjacent to the player's that it can attack.
+ *        Neutral territories are attackable, territories of negotiated players are not.
+ *
+ * @return A bitset of attackable territory IDs.
+ */
+TerritorySet Player::getAttackableSet()
+{
+  TerritorySet attackable = game->getMap()->getNeighbourSet(territorySet);
+  attackable.andNot(territorySet);
+  for (uint64_t friends = game->getDiplomacy()->peaceMask(id); friends != 0; friends &= friends - 1)
+  {
+    Player *p = game->getPlayerById(__builtin_ctzll(friends));
+    if (p != nullptr)
+    {
+      attackable.andNot(p->getTerritorySet());
+    }
+  }
+  return attackable;
+}
+
+/**
+ * @brief Get the territories owned by the other players that the player can attack.
+ *
+ * @return A bitset of enemy-owned territory IDs.
+ */
+TerritorySet Player::getEnemyOwnedSet()
+{
+  TerritorySet enemyOwned((int)game->getMap()->getTerritories()->size());
+  for (auto &p : *game->getPlayers())
+  {
+    if (canAttack(p))
+    {
+      enemyOwned |= p->getTerritorySet();
+    }
+  }
+  return enemyOwned;
+}
+
 /**
  * @brief Get the player's hand of cards.
  *
@@ -218,26 +270,30 @@ void Player::setReinforcementPool(int i)
  * @return The total continent bonus for the player.
  */
 int Player::getContinentBonus()
+{
+  auto &continents = game->getMap()->continents;
+
+  // Count how many territories the player owns in each continent, indexed by continent ID
+  auto playerTerritoryInContinentCount = game->getMap()->getStore()->countsByContinentForOwner(id, (int)continents.size());
+  return getContinentBonus(playerTerritoryInContinentCount.data());
+}
+
+/**
+ * @brief Calculate the continent bonus for the player from territory counts already taken,
+ * e.g. for every player at once with TerritoryStore::countsByOwnerAndContinent.
+ *
+ * @param ownedPerContinent The number of territories the player owns on each continent, indexed by continent ID.
+ * @return The total continent bonus for the player.
+ */
+int Player::getContinentBonus(const int *ownedPerContinent)
 {
   int continentBonusTotal = 0;
 
-  // Iterate over all continents on the map
+  // If the player owns all territories in the continent, add the continent bonus
   for (auto &continent : game->getMap()->continents)
   {
     int numOfTerritoriesInContinentMap = static_cast<int>(continent->territories.size());
-    int playerTerritoryIsInContinentCount = 0;
-
-    // Count how many territories the player owns in the continent
-    for (auto &territory : territories)
-    {
-      if (territory->getContinent()->getName() == continent->getName())
-      {
-        playerTerritoryIsInContinentCount++;
-      }
-    }
-
-    // If the player owns all territories in the continent, add the continent bonus
-    if (playerTerritoryIsInContinentCount == numOfTerritoriesInContinentMap)
+    if (ownedPerContinent[continent->getId()] == numOfTerritoriesInContinentMap)
     {
       continentBonusTotal += continent->getBonus();
     }
@@ -251,10 +307,40 @@ int Player::getContinentBonus()
  * @return The name of the player.
  */
 std::string Player::getName() const
+{
+  return game->getPlayerNames()->text(name);
+}
+
+/**
+ * @brief Get the symbol of the name of the player, which identifies the name within its game.
+ *
+ * @return The symbol of the name.
+ */
+uint32_t Player::getNameSymbol() const
 {
   return name;
 }
 
+/**
+ * @brief Get the dense ID of the player within its game.
+ *
+ * @return The ID of the player, or -1 if it has not joined a game.
+ */
+int Player::getId() const
+{
+  return id;
+}
+
+/**
+ * @brief Set the dense ID of the player within its game.
+ *
+ * @param _id The ID to set.
+ */
+void Player::setId(int _id)
+{
+  this->id = _id;
+}
+
 /**
  * @brief Add reinforcement armies to the player's reinforcement pool.
  *
@@ -266,21 +352,21 @@ void Player::addReinforcement(int reinforcement)
 }
 
 /**
- * @brief Add a player to the list of friendly players.
+ * @brief Record a negotiation with another player, in both directions.
  *
- * @param pPlayer The player to add to the friendly players list.
+ * @param pPlayer The player negotiated with.
  */
 void Player::addFriendly(Player *pPlayer)
 {
-  friendlyPlayers.push_back(pPlayer);
+  game->getDiplomacy()->makePeace(id, pPlayer->getId());
 }
 
 /**
- * @brief Clear the list of friendly players.
+ * @brief End every negotiation of the player.
  */
 void Player::clearFriendly()
 {
-  friendlyPlayers.erase(friendlyPlayers.begin(), friendlyPlayers.end());
+  game->getDiplomacy()->clearPlayer(id);
 }
 
 /**
@@ -295,16 +381,8 @@ bool Player::canAttack(Player *pPlayer)
   {
     return false;
   }
-
-  // Check if the player is in the list of friendly players
-  for (auto &player : friendlyPlayers)
-  {
-    if (player == pPlayer)
-    {
-      return false;
-    }
-  }
-  return true;
+  // Neutral territories have no owner and can always be attacked
+  return game->getDiplomacy()->canAttack(id, pPlayer == nullptr ? -1 : pPlayer->getId());
 }
 
 /**
@@ -2,6 +2,7 @@
 
 #include "GameEngine/GameEngine.h"
 #include "Map/Map.h"
+#include "Map/TerritorySet.h"
 #include "Orders/Orders.h"
 
 #include <algorithm>
@@ -30,11 +31,15 @@ private:
   std::string phase;
   int reinforcementPool;
   std::vector<Territory *> territories;
+  // Bitset mirror of territories, indexed by territory ID
+  TerritorySet territorySet;
   Hand *hand;
   OrdersList *orders;
   GameEngine *game;
-  std::string name;
-  std::vector<Player *> friendlyPlayers;
+  // Symbol of the name in the player name table of the game
+  uint32_t name;
+  // Dense index assigned by the game engine (0..N-1), -1 until the player joins a game
+  int id = -1;
 
   PlayerStrategy *strategy;
 
@@ -137,6 +142,14 @@ public:
    */
   int getContinentBonus();
 
+  /**
+   * @brief Calculates the continent bonus for the player from territory counts already taken.
+   *
+   * @param ownedPerContinent Number of territories the player owns on each continent, indexed by continent ID.
+   * @return Continent bonus.
+   */
+  int getContinentBonus(const int *ownedPerContinent);
+
   /**
    * @brief Finds the first neighboring territory of a target territory.
    *
@@ -179,14 +192,15 @@ public:
   void setReinforcementPool(int n);
 
   /**
-   * @brief Adds a friendly player to the list.
+   * @brief Records a negotiation with another player in the game's diplomacy table, for the rest of the round.
+   * Negotiations go both ways: neither player can attack the other.
    *
    * @param pPlayer Pointer to the friendly player.
    */
   void addFriendly(Player *pPlayer);
 
   /**
-   * @brief Clears the list of friendly players.
+   * @brief Ends every negotiation of the player.
    */
   void clearFriendly();
 
@@ -223,6 +237,13 @@ public:
    */
   void setStrategy(const std::string &strategy);
 
+  /**
+   * @brief Sets the dense ID of the player within its game.
+   *
+   * @param id The ID to set.
+   */
+  void setId(int id);
+
   // --------------------------------
   // Getters
   // --------------------------------
@@ -248,6 +269,27 @@ public:
    */
   std::vector<Territory *> *getTerritories();
 
+  /**
+   * @brief Gets the set of territories owned by the player.
+   *
+   * @return Reference to the bitset of owned territory IDs.
+   */
+  const TerritorySet &getTerritorySet() const;
+
+  /**
+   * @brief Gets the territories adjacent to the player's that are owned by someone the player can attack, neutral included.
+   *
+   * @return Bitset of attackable territory IDs.
+   */
+  TerritorySet getAttackableSet();
+
+  /**
+   * @brief Gets the territories owned by players that the player can attack, neutral excluded.
+   *
+   * @return Bitset of enemy-owned territory IDs.
+   */
+  TerritorySet getEnemyOwnedSet();
+
   /**
    * @brief Gets the current phase of the player.
    *
@@ -269,6 +311,20 @@ public:
    */
   std::string getName() const;
 
+  /**
+   * @brief Gets the symbol of the name of the player, which identifies the name within its game.
+   *
+   * @return The symbol of the name.
+   */
+  uint32_t getNameSymbol() const;
+
+  /**
+   * @brief Gets the dense ID of the player within its game.
+   *
+   * @return The ID of the player, or -1 if it has not joined a game.
+   */
+  int getId() const;
+
   /**
    * @brief Gets the number of deployed armies for this turn.
    *
@@ -21,10 +21,10 @@ void testPlayers()
   auto map_territories = gameEngine->getMap()->getTerritories();
 
   // adding certain territories from map to player
-  auto t1 = *map_territories->at(0);
-  auto t2 = *map_territories->at(1);
-  auto t3 = *map_territories->at(2);
-  auto t4 = *map_territories->at(3);
+  auto &t1 = *map_territories->at(0);
+  auto &t2 = *map_territories->at(1);
+  auto &t3 = *map_territories->at(2);
+  auto &t4 = *map_territories->at(3);
 
   p->addTerritory(t1);
   p->addTerritory(t2);
@@ -2,10 +2,55 @@
 #include "Player.h"
 #include "Cards/Cards.h"
 #include "Orders/Orders.h"
+#include "MonteCarloSearch.h"
+
+/**
+ * @brief Lowercases a strategy name and splits the search budget off "mcts:<ms>".
+ *
+ * @param strategy The strategy name.
+ * @param budget Set to the budget in milliseconds, or 0 if the name has none.
+ * @return The lowercase name without its budget, or an empty string if the budget is invalid.
+ */
+static std::string parseStrategyName(const std::string &strategy, int &budget)
+{
+  std::string strategy_name;
+  for (auto &c : strategy)
+  {
+    strategy_name += static_cast<char>(std::tolower(c));
+  }
+
+  budget = 0;
+  if (strategy_name.compare(0, 5, "mcts:") == 0)
+  {
+    std::string digits = strategy_name.substr(5);
+    if (digits.empty() || digits.size() > 6 || digits.find_first_not_of("0123456789") != std::string::npos || std::stoi(digits) == 0)
+    {
+      return "";
+    }
+    budget = std::stoi(digits);
+    strategy_name = "mcts";
+  }
+  return strategy_name;
+}
+
+/**
+ * @brief Checks whether createStrategy accepts a strategy name, without creating the strategy.
+ *
+ * @param strategy The strategy name.
+ * @return True if the name is valid, false otherwise.
+ */
+bool PlayerStrategy::isStrategyName(const std::string &strategy)
+{
+  int budget;
+  std::string strategy_name = parseStrategyName(strategy, budget);
+  return strategy_name == "human" || strategy_name == "aggressive" || strategy_name == "benevolent" ||
+         strategy_name == "neutral" || strategy_name == "cheater" || strategy_name == "mcts" || strategy_name == "random";
+}
 
 /**
  * @brief Factory method to create a specific player strategy based on the given strategy name.
  *        The method converts the strategy name to lowercase before comparison.
+ *        "mcts" accepts a search budget in milliseconds per move, e.g. "mcts:200".
  *
  * @param player The player associated with the strategy.
  * @param strategy The name of the strategy to be created.
@@ -15,11 +60,8 @@
 PlayerStrategy *PlayerStrategy::createStrategy(Player *player, const std::string &strategy)
 {
   // Convert strategy name to lowercase for case-insensitive comparison
-  std::string strategy_name;
-  for (auto &c : strategy)
-  {
-    strategy_name += static_cast<char>(std::tolower(c));
-  }
+  int budget;
+  std::string strategy_name = parseStrategyName(strategy, budget);
 
   // Create and return the appropriate PlayerStrategy instance based on the strategy name
   if (strategy_name == "human")
@@ -42,10 +84,14 @@ PlayerStrategy *PlayerStrategy::createStrategy(Player *player, const std::string
   {
     return new Cheater(player);
   }
+  else if (strategy_name == "mcts")
+  {
+    return budget > 0 ? new MCTS(player, budget) : new MCTS(player);
+  }
   else if (strategy_name == "random")
   {
     // Randomly choose between Aggressive and Benevolent strategies
-    if (rand() % 2 == 0)
+    if (std::uniform_int_distribution<>(0, 1)(player->getGameInstance()->getRng()) == 0)
     {
       return new Aggressive(player);
     }
@@ -70,6 +116,16 @@ Human::Human(Player *player)
   this->player = player;
 }
 
+/**
+ * @brief Gets the name the strategy is created from.
+ *
+ * @return "Human".
+ */
+std::string Human::getName() const
+{
+  return "Human";
+}
+
 /**
  * @brief Allows the Human player to issue orders based on the game state.
  *        Displays a menu for deployment, advancing, playing cards, and exiting the turn.
@@ -78,7 +134,7 @@ void Human::issueOrder()
 {
   cout << "Human player " << player->getName() << " is issuing an order." << endl;
   int reinforcementPoolLeft = max(player->getReinforcementPool() - player->getDeployedArmiesThisTurn(), 0);
-  int cardsLeft = (int)player->getHand()->getCards()->size();
+  int cardsLeft = player->getHand()->size();
   cout << "You have " << reinforcementPoolLeft << " left for deployment." << endl;
   cout << "You have " << cardsLeft << " cards in your hand." << endl;
 
@@ -174,13 +230,15 @@ std::vector<Territory *> Human::toDefend()
  */
 std::vector<Territory *> Human::toAttack()
 {
-  // get all adjacent territories that are not owned by the player
+  // get all adjacent territories whose owner the player can attack, neutral included
   std::vector<Territory *> territoriesToAttack;
+  uint64_t attackable = player->getGameInstance()->getDiplomacy()->attackableMask(player->getId());
+  const int32_t *owner = player->getGameInstance()->getMap()->getStore()->owner.data();
   for (Territory *territory : *player->getTerritories())
   {
     for (Territory *adjacentTerritory : *territory->getAdjacentTerritories())
     {
-      if (adjacentTerritory->getPlayer() != player && player->canAttack(adjacentTerritory->getPlayer()))
+      if (DiplomacyTable::isAttackable(attackable, owner[adjacentTerritory->getId()]))
       {
         territoriesToAttack.push_back(adjacentTerritory);
       }
@@ -262,15 +320,14 @@ bool Human::deploy()
  */
 bool Human::playCard()
 {
-  int cardsLeft = (int)player->getHand()->getCards()->size();
+  int cardsLeft = player->getHand()->size();
   cout << "You have " << cardsLeft << " cards in your hand." << endl;
   cout << "Which card do you want to play?" << endl;
 
-  int i = 1;
-  for (Card *card : *player->getHand()->getCards())
+  for (int i = 0; i < cardsLeft; i++)
   {
-    cout << i << ". " << card->getCardTypeString() << endl;
-    i++;
+    CardType type = player->getHand()->getCardTypeAt(i);
+    cout << i + 1 << ". " << Card::CardTypeToString(type) << endl;
   }
 
   cout << "--> ";
@@ -284,10 +341,10 @@ bool Human::playCard()
     return false;
   }
 
-  Card *card = player->getHand()->getCards()->at(choice - 1);
-  card->play();
+  Card card(player->getHand()->getCardTypeAt(choice - 1), player->getGameInstance());
+  card.play();
 
-  cout << "You have " << player->getHand()->getCards()->size() << " cards left in your hand." << endl;
+  cout << "You have " << player->getHand()->size() << " cards left in your hand." << endl;
   cout << endl;
   return true;
 }
@@ -644,6 +701,16 @@ Aggressive::Aggressive(Player *player)
   this->player = player;
 }
 
+/**
+ * @brief Gets the name the strategy is created from.
+ *
+ * @return "Aggressive".
+ */
+std::string Aggressive::getName() const
+{
+  return "Aggressive";
+}
+
 /**
  * @brief Issues orders for the Aggressive player strategy. Randomly chooses to deploy, advance, or play a card.
  */
@@ -652,15 +719,16 @@ void Aggressive::issueOrder()
   // deploy armies first
   int leftoverArmies = max(player->getReinforcementPool() - player->getDeployedArmiesThisTurn(), 0);
 
-  int randomChanceOfPlayingCard = rand() % 100;
-  if (randomChanceOfPlayingCard > 50 && !player->getHand()->getHandCards()->empty())
+  std::mt19937 &rng = player->getGameInstance()->getRng();
+  int randomChanceOfPlayingCard = std::uniform_int_distribution<>(0, 99)(rng);
+  if (randomChanceOfPlayingCard > 50 && !player->getHand()->empty())
   {
     playCard();
     return;
   }
 
   // randomly choose to deploy or advance
-  if (leftoverArmies > 0 && rand() % 2 == 0)
+  if (leftoverArmies > 0 && std::uniform_int_distribution<>(0, 1)(rng) == 0)
   {
     deploy();
   }
@@ -679,23 +747,14 @@ void Aggressive::issueOrder()
 std::vector<Territory *> Aggressive::toDefend()
 {
   vector<tuple<Territory *, int>> listOfTerritories;
+  auto map = player->getGameInstance()->getMap();
+  auto enemyOwned = player->getEnemyOwnedSet();
 
   // check all neighbors for enemies
   // prioritize defending territories that are connected to enemies
   for (auto &territory : *player->getTerritories())
   {
-    int enemiesTerritories = 0;
-
-    // check for all territories the surrounding territories for enemies
-    auto adjacentTerritories = territory->getAdjacentTerritories();
-    for (auto &adjTerritory : *adjacentTerritories)
-    {
-      // check the playerID
-      if (adjTerritory->getPlayer() != player && adjTerritory->getPlayer() != nullptr && player->canAttack(adjTerritory->getPlayer()))
-      {
-        enemiesTerritories++;
-      }
-    }
+    int enemiesTerritories = territory->getId() == -1 ? 0 : map->getNeighbourSet(territory->getId()).countAnd(enemyOwned);
     listOfTerritories.emplace_back(territory, enemiesTerritories);
   }
 
@@ -715,33 +774,21 @@ std::vector<Territory *> Aggressive::toDefend()
 
 /**
  * @brief Determines the territories to attack for the Aggressive player strategy.
- *        Prioritizes territories with fewer enemies.
+ *        Prioritizes territories with fewer armies.
  *
  * @return A vector of territories to attack.
  */
 std::vector<Territory *> Aggressive::toAttack()
 {
-  // get all territories that are not owned by the player
+  // get all neighbouring territories that are not owned by the player or a negotiated player
   vector<Territory *> listOfTerritories;
-
-  // check all neighbors for enemies
-  // prioritize territories with fewer enemies
-  for (auto &t : *player->getTerritories())
-  {
-    // check for all territories the surrounding territories for enemies
-    auto adjacentTerritories = t->getAdjacentTerritories();
-    for (auto &adjTerritory : *adjacentTerritories)
-    {
-      if (adjTerritory->getPlayer() != player && player->canAttack(adjTerritory->getPlayer()))
-      {
-        listOfTerritories.push_back(adjTerritory);
-      }
-    }
-  }
+  auto map = player->getGameInstance()->getMap();
+  player->getAttackableSet().forEach([&](int id)
+                                     { listOfTerritories.push_back(map->getTerritoryById(id)); });
 
   // target the territory with the least armies
-  sort(listOfTerritories.begin(), listOfTerritories.end(), [](const Territory *lhs, const Territory *rhs)
-       { return lhs->getArmies() > lhs->getArmies(); });
+  std::stable_sort(listOfTerritories.begin(), listOfTerritories.end(), [](const Territory *lhs, const Territory *rhs)
+                   { return lhs->getArmies() < rhs->getArmies(); });
 
   return listOfTerritories;
 }
@@ -819,7 +866,7 @@ void Aggressive::advance()
     // use the strongest territory to attack
     for (auto &t2 : territoriesToDefend)
     {
-      if (std::find(t->getAdjacentTerritories()->begin(), t->getAdjacentTerritories()->end(), t2) != t->getAdjacentTerritories()->end())
+      if (t->isAdjacent(t2))
       {
         // check if the territory has enough armies to attack
         if (t2->getArmies() < 3)
@@ -836,16 +883,65 @@ void Aggressive::advance()
     }
   }
 
+  // nothing on the front is strong enough, bring armies from the back instead
+  if (moveTowardFront())
+  {
+    return;
+  }
+
   cout << "You don't have any territories to attack." << endl;
 }
 
+/**
+ * @brief Moves the armies of the strongest territory away from the front one step toward the nearest
+ *        territory that can be attacked.
+ *
+ * @return True if an order was issued, false otherwise.
+ */
+bool Aggressive::moveTowardFront()
+{
+  auto map = player->getGameInstance()->getMap();
+  auto attackable = player->getAttackableSet();
+  if (!attackable.any())
+  {
+    return false;
+  }
+  DistanceField front = map->getDistanceOracle().towards(attackable);
+
+  // territories next to a target attack instead of moving
+  Territory *strongestTerritory = nullptr;
+  for (auto &territory : *player->getTerritories())
+  {
+    if (front.distance(territory->getId()) > 1 && territory->getArmies() > 1 &&
+        (strongestTerritory == nullptr || territory->getArmies() > strongestTerritory->getArmies()))
+    {
+      strongestTerritory = territory;
+    }
+  }
+  if (strongestTerritory == nullptr)
+  {
+    return false;
+  }
+
+  Territory *nextTerritory = map->getTerritoryById(front.nextHop(strongestTerritory->getId()));
+  if (nextTerritory->getPlayer() != player)
+  {
+    return false;
+  }
+
+  cout << "Moving armies from " << strongestTerritory->getName() << " to " << nextTerritory->getName() << " toward the front." << endl;
+  player->getOrdersListObject()->add(new Advance(player->getGameInstance(), strongestTerritory, nextTerritory, player, strongestTerritory->getArmies() - 1));
+  return true;
+}
+
 /**
  * @brief Plays a card for the Aggressive player strategy.
  *        Aggressive players will play bomb cards first, followed by a random card.
  */
 void Aggressive::playCard()
 {
-  if (player->getHand()->getHandCards()->empty())
+  Hand *hand = player->getHand();
+  if (hand->empty())
   {
     return;
   }
@@ -853,18 +949,15 @@ void Aggressive::playCard()
   // aggressive players will play aggressive cards first
 
   // play the bomb cards first
-  for (auto &card : *player->getHand()->getHandCards())
+  if (hand->count(CardType::CT_Bomb) > 0)
   {
-    if (card->getCardType() == CardType::CT_Bomb)
-    {
-      card->play();
-      return;
-    }
+    Card(CardType::CT_Bomb, player->getGameInstance()).play();
+    return;
   }
 
   // play random card
-  int randomCard = rand() % player->getHand()->getHandCards()->size();
-  player->getHand()->getHandCards()->at(randomCard)->play();
+  int randomCard = std::uniform_int_distribution<>(0, hand->size() - 1)(player->getGameInstance()->getRng());
+  Card(hand->getCardTypeAt(randomCard), player->getGameInstance()).play();
 }
 
 /**
@@ -1016,6 +1109,26 @@ Order *Aggressive::playAirliftCard()
   return new Airlift(player->getGameInstance(), territoryToAirliftFrom, territoryToAirliftTo, player, territoryToAirliftFrom->getArmies() - 1);
 }
 
+/**
+ * @brief Checks whether the strategy never attacks. Strategies are not passive unless they say so.
+ *
+ * @return False.
+ */
+bool PlayerStrategy::isPassive() const
+{
+  return false;
+}
+
+/**
+ * @brief Benevolent players only deploy and move armies to their weakest territories.
+ *
+ * @return True.
+ */
+bool Benevolent::isPassive() const
+{
+  return true;
+}
+
 /**
  * @brief Constructor for the Benevolent player strategy.
  *
@@ -1026,6 +1139,16 @@ Benevolent::Benevolent(Player *player)
   this->player = player;
 }
 
+/**
+ * @brief Gets the name the strategy is created from.
+ *
+ * @return "Benevolent".
+ */
+std::string Benevolent::getName() const
+{
+  return "Benevolent";
+}
+
 /**
  * @brief Issues orders for the Benevolent player strategy.
  *        Deploys armies to the weakest territory.
@@ -1046,20 +1169,61 @@ void Benevolent::issueOrder()
     }
 
     // deploy armies to the weakest territory
+    std::mt19937 &rng = player->getGameInstance()->getRng();
     auto randomWeakTerritory = territoriesToDefend.at(0);
     if (territoriesToDefend.size() > 1)
     {
-      randomWeakTerritory = territoriesToDefend.at((rand() % (territoriesToDefend.size() - 1)));
+      randomWeakTerritory = territoriesToDefend.at(std::uniform_int_distribution<size_t>(0, territoriesToDefend.size() - 2)(rng));
     }
 
     cout << "Deploying " << armiesLeftToDeploy << " armies to " << randomWeakTerritory->getName() << "." << endl;
-    int randomAmountOfArmiesToDeploy = rand() % armiesLeftToDeploy + 1;
+    int randomAmountOfArmiesToDeploy = std::uniform_int_distribution<>(1, armiesLeftToDeploy)(rng);
 
     player->addDeployedArmies(randomAmountOfArmiesToDeploy);
     player->getOrdersListObject()->add(new Deploy(player->getGameInstance(), randomWeakTerritory, player, randomAmountOfArmiesToDeploy));
+
+    // once everything is deployed, spread the surplus of the strongest territory
+    if (randomAmountOfArmiesToDeploy == armiesLeftToDeploy)
+    {
+      routeReinforcements();
+    }
   }
 }
 
+/**
+ * @brief Moves half the difference between the strongest and the weakest territory one step from the strongest
+ *        toward the weakest, along a shortest path on the map. The path may cross other players' territories, so
+ *        nothing moves unless its first step is a territory of the player.
+ */
+void Benevolent::routeReinforcements()
+{
+  auto territories = player->getTerritories();
+  if (territories->size() < 2)
+  {
+    return;
+  }
+  auto byArmies = [](const Territory *lhs, const Territory *rhs)
+  { return lhs->getArmies() < rhs->getArmies(); };
+  Territory *weakestTerritory = *std::min_element(territories->begin(), territories->end(), byArmies);
+  Territory *strongestTerritory = *std::max_element(territories->begin(), territories->end(), byArmies);
+  int surplus = (strongestTerritory->getArmies() - weakestTerritory->getArmies()) / 2;
+  if (surplus < 1)
+  {
+    return;
+  }
+
+  auto map = player->getGameInstance()->getMap();
+  int nextId = map->getDistanceOracle().nextHop(strongestTerritory->getId(), weakestTerritory->getId());
+  if (nextId == -1 || nextId == strongestTerritory->getId() || map->getTerritoryById(nextId)->getPlayer() != player)
+  {
+    return;
+  }
+
+  Territory *nextTerritory = map->getTerritoryById(nextId);
+  cout << "Moving " << surplus << " armies from " << strongestTerritory->getName() << " to " << nextTerritory->getName() << " toward " << weakestTerritory->getName() << "." << endl;
+  player->getOrdersListObject()->add(new Advance(player->getGameInstance(), strongestTerritory, nextTerritory, player, surplus));
+}
+
 /**
  * @brief Retrieves the territories to defend for the Benevolent player strategy.
  *        Prioritizes defending territories connected to enemies.
@@ -1069,21 +1233,14 @@ void Benevolent::issueOrder()
 std::vector<Territory *> Benevolent::toDefend()
 {
   vector<tuple<Territory *, int>> listOfTerritories;
+  auto map = player->getGameInstance()->getMap();
+  auto enemyOwned = player->getEnemyOwnedSet();
+
   // check all neighbours for enemies
   // prioritize defending the territories that are connected to enemies
   for (auto &territory : *player->getTerritories())
   {
-    int enemiesTerritories = 0;
-    // check for all territories the surrounding territories for enemies
-    auto adjacentTerritories = territory->getAdjacentTerritories();
-    for (auto &adjTerritory : *adjacentTerritories)
-    {
-      // check the playerID
-      if (adjTerritory->getPlayer() != player && adjTerritory->getPlayer() != nullptr && player->canAttack(adjTerritory->getPlayer()))
-      {
-        enemiesTerritories++;
-      }
-    }
+    int enemiesTerritories = territory->getId() == -1 ? 0 : map->getNeighbourSet(territory->getId()).countAnd(enemyOwned);
     listOfTerritories.emplace_back(territory, enemiesTerritories);
   }
 
@@ -1265,6 +1422,36 @@ std::vector<Territory *> Neutral::toAttack()
   return {};
 }
 
+/**
+ * @brief Neutral players do not issue orders. Once attacked they become Aggressive, which is not passive.
+ *
+ * @return True.
+ */
+bool Neutral::isPassive() const
+{
+  return true;
+}
+
+/**
+ * @brief Gets the number of territories the player had on its last turn, to tell whether it was attacked since.
+ *
+ * @return The number of territories, or -1 before its first turn.
+ */
+int Neutral::getTerritoriesLastTurn() const
+{
+  return numberOfTerritoriesLastTurn;
+}
+
+/**
+ * @brief Sets the number of territories the player had on its last turn, when a game is resumed.
+ *
+ * @param territories The number of territories, or -1 before its first turn.
+ */
+void Neutral::setTerritoriesLastTurn(int territories)
+{
+  numberOfTerritoriesLastTurn = territories;
+}
+
 /**
  * @brief Constructor for the Neutral player strategy.
  *
@@ -1275,6 +1462,16 @@ Neutral::Neutral(Player *player)
   this->player = player;
 }
 
+/**
+ * @brief Gets the name the strategy is created from.
+ *
+ * @return "Neutral".
+ */
+std::string Neutral::getName() const
+{
+  return "Neutral";
+}
+
 /**
  * @brief Decides the order to issue based on the given card for the Neutral player strategy.
  *
@@ -1294,20 +1491,16 @@ void Cheater::issueOrder()
 {
   cout << "Cheater Player " + player->getName() + " is issuing orders!" << endl;
   // conquer all adjacent territories
-  auto territories = player->getTerritories();
-
-  for (auto &adj : *territories)
-  {
+  auto map = player->getGameInstance()->getMap();
+  player->getAttackableSet().forEach([&](int id)
+                                     {
+    auto adj = map->getTerritoryById(id);
     cout << "Cheater Player " + player->getName() + " is conquering " + adj->getName() << endl;
-    player->addTerritory(*adj);
-  }
+    player->addTerritory(*adj); });
 
   player->setDeployedArmiesThisTurn(player->getReinforcementPool());
   // deploy all armies on all territories
-  for (auto &territory : *player->getTerritories())
-  {
-    territory->setArmies(territory->getArmies() + player->getReinforcementPool());
-  }
+  map->getStore()->addArmiesWhereOwner(player->getId(), player->getReinforcementPool());
 
   player->setDeployedArmiesThisTurn(player->getReinforcementPool());
 }
@@ -1344,6 +1537,16 @@ Cheater::Cheater(Player *player)
   this->player = player;
 }
 
+/**
+ * @brief Gets the name the strategy is created from.
+ *
+ * @return "Cheater".
+ */
+std::string Cheater::getName() const
+{
+  return "Cheater";
+}
+
 /**
  * @brief Decides the order to issue based on the given card for the Cheater player strategy.
  *
@@ -1354,3 +1557,119 @@ Order *Cheater::decideCard(Card *card)
 {
   return nullptr;
 }
+
+/**
+ * @brief Constructor for the MCTS player strategy.
+ *
+ * @param player Pointer to the associated player.
+ * @param msPerMove The time spent searching each move, in milliseconds.
+ * @param threads The number of search threads, or 0 to use one per hardware thread.
+ */
+MCTS::MCTS(Player *player, int msPerMove, int threads) : msPerMove(msPerMove), threads(threads)
+{
+  this->player = player;
+}
+
+/**
+ * @brief Gets the name the strategy is created from, with its time budget.
+ *
+ * @return "MCTS:<ms per move>".
+ */
+std::string MCTS::getName() const
+{
+  return "MCTS:" + std::to_string(msPerMove);
+}
+
+/**
+ * @brief Issues orders for the MCTS player strategy.
+ *        Searches the moves of this turn, then deploys the whole pool on the chosen source and,
+ *        if the move is an attack, advances all but one army from there.
+ */
+void MCTS::issueOrder()
+{
+  int pool = max(player->getReinforcementPool() - player->getDeployedArmiesThisTurn(), 0);
+  auto game = player->getGameInstance();
+  auto map = game->getMap();
+
+  // Engines played side by side already use every core, so their searches stay on one thread
+  int searchThreads = threads > 0 ? threads : (game->parallelRun ? 1 : 0);
+  // Seeded from the game so a seeded game replays the same searches; 0 would mean std::random_device
+  uint64_t seed = ((uint64_t)game->getRng()() << 32) | game->getRng()() | 1;
+  MonteCarloSearch search(player);
+  SearchResult result = search.search(msPerMove, searchThreads, 0, seed);
+  player->setDeployedArmiesThisTurn(player->getReinforcementPool());
+  if (result.best == -1)
+  {
+    cout << "MCTS player " << player->getName() << " has no territory to deploy to." << endl;
+    return;
+  }
+
+  const SimAction &move = search.getActions()[result.best];
+  Territory *source = map->getTerritoryById(move.source);
+  cout << "MCTS player " << player->getName() << " ran " << result.rollouts << " rollouts and is deploying "
+       << pool << " armies to " << source->getName() << "." << endl;
+  if (pool > 0)
+  {
+    player->getOrdersListObject()->add(new Deploy(game, source, player, pool));
+  }
+
+  int armies = source->getArmies() + pool - 1;
+  if (move.target != -1 && armies > 0)
+  {
+    Territory *target = map->getTerritoryById(move.target);
+    cout << "Attacking " << target->getName() << " from " << source->getName() << "." << endl;
+    player->getOrdersListObject()->add(new Advance(game, source, target, player, armies));
+  }
+}
+
+/**
+ * @brief Decides the order to issue based on the given card for the MCTS player strategy.
+ *
+ * @param card Pointer to the card to be played.
+ * @return nullptr as MCTS does not play cards.
+ */
+Order *MCTS::decideCard(Card *card)
+{
+  return nullptr;
+}
+
+/**
+ * @brief Retrieves territories to defend for the MCTS player strategy.
+ *        Returns the player's territories with the most armies first.
+ *
+ * @return A vector of territories to defend.
+ */
+std::vector<Territory *> MCTS::toDefend()
+{
+  vector<Territory *> territories = *player->getTerritories();
+  std::stable_sort(territories.begin(), territories.end(), [](const Territory *lhs, const Territory *rhs)
+                   { return lhs->getArmies() > rhs->getArmies(); });
+  return territories;
+}
+
+/**
+ * @brief Retrieves territories to attack for the MCTS player strategy.
+ *        Returns every attackable territory with the fewest armies first.
+ *
+ * @return A vector of territories to attack.
+ */
+std::vector<Territory *> MCTS::toAttack()
+{
+  vector<Territory *> territories;
+  auto map = player->getGameInstance()->getMap();
+  player->getAttackableSet().forEach([&](int id)
+                                     { territories.push_back(map->getTerritoryById(id)); });
+  std::stable_sort(territories.begin(), territories.end(), [](const Territory *lhs, const Territory *rhs)
+                   { return lhs->getArmies() < rhs->getArmies(); });
+  return territories;
+}
+
+/**
+ * @brief Gets the time spent searching each move.
+ *
+ * @return The budget in milliseconds.
+ */
+int MCTS::getMsPerMove() const
+{
+  return msPerMove;
+}
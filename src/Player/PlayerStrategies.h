@@ -44,6 +44,20 @@ public:
    */
   virtual std::vector<Territory *> toAttack() = 0;
 
+  /**
+   * @brief Checks whether the strategy never attacks, so it cannot take territories from other players.
+   *
+   * @return True if the strategy is passive, false otherwise.
+   */
+  virtual bool isPassive() const;
+
+  /**
+   * @brief Gets the name the strategy is created from, so createStrategy(player, getName()) gives the same strategy.
+   *
+   * @return The strategy name.
+   */
+  virtual std::string getName() const = 0;
+
   /**
    * @brief Static method to create a PlayerStrategy based on the player and a specified strategy.
    *
@@ -52,6 +66,14 @@ public:
    * @return A pointer to the created PlayerStrategy.
    */
   static PlayerStrategy *createStrategy(Player *player, const std::string &strategy);
+
+  /**
+   * @brief Checks whether createStrategy accepts a strategy name, without creating the strategy.
+   *
+   * @param strategy The strategy name.
+   * @return True if the name is valid, false otherwise.
+   */
+  static bool isStrategyName(const std::string &strategy);
 };
 
 // ----------------------------------------
@@ -61,6 +83,13 @@ class Human : public PlayerStrategy
 {
 public:
   explicit Human(Player *player);
+
+  /**
+   * @brief Gets the name the strategy is created from.
+   *
+   * @return The strategy name.
+   */
+  std::string getName() const override;
   /**
    * @brief Implementation of issuing orders for a human player.
    */
@@ -116,6 +145,13 @@ class Aggressive : public PlayerStrategy
 {
 public:
   explicit Aggressive(Player *player);
+
+  /**
+   * @brief Gets the name the strategy is created from.
+   *
+   * @return The strategy name.
+   */
+  std::string getName() const override;
   /**
    * @brief Implementation of issuing orders for an aggressive player.
    */
@@ -148,6 +184,7 @@ private:
 
     void deploy();
     void advance();
+    bool moveTowardFront();
 
     Order* playBombCard();
     Order* playReinforcementCard();
@@ -163,6 +200,13 @@ class Benevolent : public PlayerStrategy
 {
 public:
   explicit Benevolent(Player *player);
+
+  /**
+   * @brief Gets the name the strategy is created from.
+   *
+   * @return The strategy name.
+   */
+  std::string getName() const override;
   /**
    * @brief Implementation of issuing orders for a benevolent player.
    */
@@ -190,6 +234,17 @@ public:
    */
   std::vector<Territory *> toAttack() override;
 
+  /**
+   * @brief A benevolent player never attacks.
+   *
+   * @return True.
+   */
+  bool isPassive() const override;
+
+private:
+    void routeReinforcements();
+
+public:
     Order* playReinforcementCard();
     Order* playBlockadeCard();
     Order* playDiplomacyCard();
@@ -206,6 +261,13 @@ private:
 
 public:
   explicit Neutral(Player *player);
+
+  /**
+   * @brief Gets the name the strategy is created from.
+   *
+   * @return The strategy name.
+   */
+  std::string getName() const override;
   /**
    * @brief Implementation of issuing orders for a neutral player.
    */
@@ -232,6 +294,27 @@ public:
    * @return A vector of territories to attack.
    */
   std::vector<Territory *> toAttack() override;
+
+  /**
+   * @brief A neutral player does not attack until it is attacked, and then switches to Aggressive.
+   *
+   * @return True.
+   */
+  bool isPassive() const override;
+
+  /**
+   * @brief Gets the number of territories the player had on its last turn.
+   *
+   * @return The number of territories, or -1 before its first turn.
+   */
+  int getTerritoriesLastTurn() const;
+
+  /**
+   * @brief Sets the number of territories the player had on its last turn, when a game is resumed.
+   *
+   * @param territories The number of territories, or -1 before its first turn.
+   */
+  void setTerritoriesLastTurn(int territories);
 };
 
 // ----------------------------------------
@@ -241,6 +324,13 @@ class Cheater : public PlayerStrategy
 {
 public:
   explicit Cheater(Player *player);
+
+  /**
+   * @brief Gets the name the strategy is created from.
+   *
+   * @return The strategy name.
+   */
+  std::string getName() const override;
   /**
    * @brief Implementation of issuing orders for a cheater player.
    */
@@ -268,3 +358,66 @@ public:
    */
   std::vector<Territory *> toAttack() override;
 };
+
+// ----------------------------------------
+// MCTS: Computer player choosing its move with a time-budgeted Monte Carlo search.
+// ----------------------------------------
+class MCTS : public PlayerStrategy
+{
+private:
+  int msPerMove;
+  int threads;
+
+public:
+  /**
+   * @brief Constructor for the MCTS player strategy.
+   *
+   * @param player The player associated with the strategy.
+   * @param msPerMove The time spent searching each move, in milliseconds.
+   * @param threads The number of search threads, or 0 to use one per hardware thread, or a single one when the
+   * game is part of a parallel run.
+   */
+  explicit MCTS(Player *player, int msPerMove = 50, int threads = 0);
+
+  /**
+   * @brief Gets the name the strategy is created from.
+   *
+   * @return The strategy name.
+   */
+  std::string getName() const override;
+
+  /**
+   * @brief Searches for the best move, then deploys the whole pool on its source and attacks its target with
+   * all but one army.
+   */
+  void issueOrder() override;
+
+  /**
+   * @brief The MCTS player does not play cards.
+   *
+   * @param card The card to make decisions based on.
+   * @return nullptr.
+   */
+  Order *decideCard(Card *card) override;
+
+  /**
+   * @brief Determines territories to defend: the player's territories, strongest first.
+   *
+   * @return A vector of territories to defend.
+   */
+  std::vector<Territory *> toDefend() override;
+
+  /**
+   * @brief Determines territories to attack: every territory the player can attack, weakest first.
+   *
+   * @return A vector of territories to attack.
+   */
+  std::vector<Territory *> toAttack() override;
+
+  /**
+   * @brief Gets the time spent searching each move.
+   *
+   * @return The budget in milliseconds.
+   */
+  int getMsPerMove() const;
+};
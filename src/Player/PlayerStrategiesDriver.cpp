@@ -1,5 +1,8 @@
 #include "PlayerStrategiesDriver.h"
 #include "GameEngine/GameEngine.h"
+#include "MonteCarloSearch.h"
+
+#include <thread>
 
 using namespace std;
 
@@ -28,35 +31,35 @@ void testPlayerStrategies()
 
     // add cards to the gameEngine deck; 5 of each
     auto deck = gameEngine.getDeck();
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Reinforcement, &gameEngine));
-
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Airlift, &gameEngine));
-
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Diplomacy, &gameEngine));
-
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Bomb, &gameEngine));
-
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
-    deck->addCardToDeck(new Card(CardType::CT_Blockade, &gameEngine));
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+    deck->addCardToDeck(CardType::CT_Reinforcement);
+
+    deck->addCardToDeck(CardType::CT_Airlift);
+    deck->addCardToDeck(CardType::CT_Airlift);
+    deck->addCardToDeck(CardType::CT_Airlift);
+    deck->addCardToDeck(CardType::CT_Airlift);
+    deck->addCardToDeck(CardType::CT_Airlift);
+
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+    deck->addCardToDeck(CardType::CT_Diplomacy);
+
+    deck->addCardToDeck(CardType::CT_Bomb);
+    deck->addCardToDeck(CardType::CT_Bomb);
+    deck->addCardToDeck(CardType::CT_Bomb);
+    deck->addCardToDeck(CardType::CT_Bomb);
+    deck->addCardToDeck(CardType::CT_Bomb);
+
+    deck->addCardToDeck(CardType::CT_Blockade);
+    deck->addCardToDeck(CardType::CT_Blockade);
+    deck->addCardToDeck(CardType::CT_Blockade);
+    deck->addCardToDeck(CardType::CT_Blockade);
+    deck->addCardToDeck(CardType::CT_Blockade);
 
     // load a map before the game starts
     gameEngine.loadMap("../res/TestMap1_valid.map");
@@ -97,35 +100,76 @@ void testPlayerStrategies()
         player5->addTerritory(*t);
     }
 
-    player1->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-    player1->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-    player1->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-    player1->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-    player1->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-
-    player2->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-    player2->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-    player2->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-    player2->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-    player2->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-
-    player3->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-    player3->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-    player3->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-    player3->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-    player3->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-
-    player4->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-    player4->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-    player4->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-    player4->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-    player4->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
-
-    player5->getHand()->addToHand(new Card(CardType::CT_Reinforcement, &gameEngine));
-    player5->getHand()->addToHand(new Card(CardType::CT_Blockade, &gameEngine));
-    player5->getHand()->addToHand(new Card(CardType::CT_Bomb, &gameEngine));
-    player5->getHand()->addToHand(new Card(CardType::CT_Diplomacy, &gameEngine));
-    player5->getHand()->addToHand(new Card(CardType::CT_Airlift, &gameEngine));
+    player1->getHand()->addToHand(CardType::CT_Reinforcement);
+    player1->getHand()->addToHand(CardType::CT_Blockade);
+    player1->getHand()->addToHand(CardType::CT_Bomb);
+    player1->getHand()->addToHand(CardType::CT_Diplomacy);
+    player1->getHand()->addToHand(CardType::CT_Airlift);
+
+    player2->getHand()->addToHand(CardType::CT_Reinforcement);
+    player2->getHand()->addToHand(CardType::CT_Blockade);
+    player2->getHand()->addToHand(CardType::CT_Bomb);
+    player2->getHand()->addToHand(CardType::CT_Diplomacy);
+    player2->getHand()->addToHand(CardType::CT_Airlift);
+
+    player3->getHand()->addToHand(CardType::CT_Reinforcement);
+    player3->getHand()->addToHand(CardType::CT_Blockade);
+    player3->getHand()->addToHand(CardType::CT_Bomb);
+    player3->getHand()->addToHand(CardType::CT_Diplomacy);
+    player3->getHand()->addToHand(CardType::CT_Airlift);
+
+    player4->getHand()->addToHand(CardType::CT_Reinforcement);
+    player4->getHand()->addToHand(CardType::CT_Blockade);
+    player4->getHand()->addToHand(CardType::CT_Bomb);
+    player4->getHand()->addToHand(CardType::CT_Diplomacy);
+    player4->getHand()->addToHand(CardType::CT_Airlift);
+
+    player5->getHand()->addToHand(CardType::CT_Reinforcement);
+    player5->getHand()->addToHand(CardType::CT_Blockade);
+    player5->getHand()->addToHand(CardType::CT_Bomb);
+    player5->getHand()->addToHand(CardType::CT_Diplomacy);
+    player5->getHand()->addToHand(CardType::CT_Airlift);
 
     gameEngine.mainGameLoop();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Benchmarks the rollout rate of the MCTS search on one and on every hardware thread.
+ */
+void benchmarkMonteCarloSearch()
+{
+    const std::string mapFile = "res/TestMap1_valid.map";
+    const int budgetMs = 500;
+
+    // mocking argc and argv
+    int argc = 1;
+    char *argv[] = {(char *)"-console"};
+
+    GameEngine gameEngine = GameEngine(argc, argv, true);
+    gameEngine.loadMap(mapFile);
+    auto player1 = new Player(&gameEngine, new Hand(), "Searcher", "MCTS");
+    auto player2 = new Player(&gameEngine, new Hand(), "Opponent", "Aggressive");
+
+    // split the map and its armies evenly
+    auto territories = gameEngine.getMap()->getTerritories();
+    for (int i = 0; i < (int)territories->size(); i++)
+    {
+        territories->at(i)->setArmies(3 + i % 5);
+        (i % 2 == 0 ? player1 : player2)->addTerritory(*territories->at(i));
+    }
+    player1->addReinforcement(10);
+    player2->addReinforcement(10);
+
+    MonteCarloSearch search(player1);
+    std::vector<int> threadCounts = {1};
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        threadCounts.push_back((int)std::thread::hardware_concurrency());
+    }
+    for (int threads : threadCounts)
+    {
+        SearchResult result = search.search(budgetMs, threads);
+        std::cout << "MCTS on " << mapFile << " (" << territories->size() << " territories, " << search.getActions().size()
+                  << " moves), " << threads << " thread(s): " << (long)(result.rollouts / result.seconds) << " rollouts per second" << std::endl;
+    }
+}
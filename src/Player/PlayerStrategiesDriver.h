@@ -4,3 +4,8 @@
  * @brief Test function for PlayerStrategy execution.
  */
 void testPlayerStrategies();
+
+/**
+ * @brief Benchmarks the rollout rate of the MCTS search.
+ */
+void benchmarkMonteCarloSearch();
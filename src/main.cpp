@@ -1,4 +1,5 @@
 #include <cstring>
+#include <cstdlib>
 #include "GameEngine/GameEngineDriver.h"
 #include "Orders/OrdersDriver.h"
 #include "GameEngine/Command/CommandProcessingDriver.h"
@@ -6,24 +7,134 @@
 #include "GameEngine/TournamentDriver.h"
 #include "Player/PlayerDriver.h"
 #include "Player/PlayerStrategiesDriver.h"
+#include "Map/MapDriver.h"
+#include "GameEngine/Command/CommandScript.h"
 
 using namespace std;
 
+// Engine settings given on the command line
+struct EngineOptions
+{
+    bool unlimitedTournaments = false;
+    const char* seed = nullptr;
+    const char* replayFile = nullptr;
+    const char* checkpointFile = nullptr;
+    bool resumeTournament = false;
+};
+
+/**
+ * @brief Applies the engine settings given on the command line, for scripted and interactive runs alike.
+ * @param gameEngine The engine to set up.
+ * @param options The settings.
+ */
+static void configureEngine(GameEngine& gameEngine, const EngineOptions& options)
+{
+    if(options.unlimitedTournaments)
+    {
+        gameEngine.tournamentLimits = TournamentLimits::unlimited();
+    }
+    if(options.seed)
+    {
+        gameEngine.setSeed((uint32_t)strtoul(options.seed, nullptr, 10));
+    }
+    if(options.checkpointFile)
+    {
+        gameEngine.checkpointFile = options.checkpointFile;
+    }
+    gameEngine.resumeTournament = options.resumeTournament;
+    if(options.replayFile)
+    {
+        gameEngine.recordReplays(options.replayFile);
+    }
+}
+
 int main(int argc, char** argv)
 {
     bool runTests = false;
+    bool runBenchmarks = false;
+    const char* scriptFile = nullptr;
+    EngineOptions options;
 
-    // Check if the -test argument is passed
+    // Check if the -test or -bench argument is passed
     for(int i = 1; i < argc; i++)
     {
+        if(strcmp(argv[i], "-unlimited") == 0)
+        {
+            options.unlimitedTournaments = true;
+            continue;
+        }
+        if(strcmp(argv[i], "-seed") == 0 && i + 1 < argc)
+        {
+            options.seed = argv[++i];
+            continue;
+        }
+        if(strcmp(argv[i], "-record") == 0 && i + 1 < argc)
+        {
+            options.replayFile = argv[++i];
+            continue;
+        }
+        if(strcmp(argv[i], "-checkpoint") == 0 && i + 1 < argc)
+        {
+            options.checkpointFile = argv[++i];
+            continue;
+        }
+        if(strcmp(argv[i], "-resume") == 0)
+        {
+            options.resumeTournament = true;
+            continue;
+        }
         if(strcmp(argv[i], "-test") == 0)
         {
             runTests = true;
             break;
         }
+        if(strcmp(argv[i], "-bench") == 0)
+        {
+            runBenchmarks = true;
+            break;
+        }
+        if(strcmp(argv[i], "-script") == 0 && i + 1 < argc)
+        {
+            scriptFile = argv[++i];
+            continue;
+        }
     }
 
-    if(runTests)
+    if(runBenchmarks)
+    {
+        benchmarkMapClone();
+        benchmarkMapLoad();
+        benchmarkTerritoryKernels();
+        benchmarkFileLineReader();
+        benchmarkCommandParser();
+        benchmarkMonteCarloSearch();
+    }
+    else if(scriptFile)
+    {
+        try
+        {
+            // Check the whole script first, then run it without the interactive command processor
+            CommandScript script = CommandScript::fromFile(scriptFile);
+            if(!script.isValid())
+            {
+                for(const auto& error : script.getErrors())
+                {
+                    cerr << error << endl;
+                }
+                return 1;
+            }
+            auto gameEngine = GameEngine(argc, argv);
+            configureEngine(gameEngine, options);
+            int games = script.execute(&gameEngine, cout);
+            cout << games << " game(s) played" << endl;
+        }
+        catch(std::runtime_error& err)
+        {
+            cerr << err.what() << endl;
+            return 1;
+        }
+    }
+    else if(runTests)
     {
         // Run the tests
         testTournament(argc, argv);
@@ -33,6 +144,7 @@ int main(int argc, char** argv)
     {
         // Run the game normally
         auto gameEngine = GameEngine(argc, argv);
+        configureEngine(gameEngine, options);
         gameEngine.startupPhase();
     }
 
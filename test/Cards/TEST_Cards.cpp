@@ -25,8 +25,10 @@ TEST(CardTestSuite, AddingCards)
   deck->addCardToDeck(new Card(CT_Blockade, &gameEngine));
   deck->addCardToDeck(new Card(CT_Airlift, &gameEngine));
   // assert
-  auto cards = *deck->getDeckCards();
-  EXPECT_EQ(cards.size(), 10);
+  EXPECT_EQ(deck->size(), 10);
+  EXPECT_EQ(deck->count(CT_Bomb), 3);
+  EXPECT_EQ(deck->count(CT_Diplomacy), 3);
+  EXPECT_EQ(deck->count(CT_Reinforcement), 0);
 }
 
 TEST(CardTestSuite, DrawFromDeck)
@@ -55,10 +57,8 @@ TEST(CardTestSuite, DrawFromDeck)
   deck->draw(*player->getHand());
   deck->draw(*player->getHand());
   // assert
-  auto cards = *deck->getDeckCards();
-  auto player_cards = player->getHand()->getCards();
-  EXPECT_EQ(cards.size(), 8);
-  EXPECT_EQ(player_cards->size(), 2);
+  EXPECT_EQ(deck->size(), 8);
+  EXPECT_EQ(player->getHand()->size(), 2);
 }
 
 TEST(CardTestSuite, PlayCard)
@@ -83,11 +83,105 @@ TEST(CardTestSuite, PlayCard)
   gameEngine.setCurrentPlayer(player);
 
   // act
-  player->getHand()->getHandCards()->at(0)->play();
+  Card(player->getHand()->getCardTypeAt(0), &gameEngine).play();
 
   // assert
-  EXPECT_EQ(gameEngine.getDeck()->getDeckCards()->size(), 1);
-  EXPECT_TRUE(player->getHand()->getHandCards()->empty());
+  EXPECT_EQ(gameEngine.getDeck()->size(), 1);
+  EXPECT_TRUE(player->getHand()->empty());
+}
+
+TEST(CardTestSuite, CountsStayConsistentOverManyDraws)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  Deck* deck = gameEngine.getDeck();
+  Hand hand;
+  deck->create_deck();
+  int drawnBombs = 0;
+
+  // act
+  for (int round = 0; round < 1000; round++)
+  {
+    deck->draw(hand);
+    CardType type = hand.getCardTypeAt(0);
+    drawnBombs += type == CT_Bomb;
+    EXPECT_TRUE(hand.removeCard(type));
+    deck->addCardToDeck(type);
+  }
+
+  // assert
+  EXPECT_EQ(deck->size(), 40);
+  for (int type = 0; type < CARD_TYPE_COUNT; type++)
+  {
+    EXPECT_EQ(deck->count((CardType)type), 8);
+  }
+  EXPECT_TRUE(hand.empty());
+  EXPECT_FALSE(hand.removeCard(CT_Bomb));
+  // every type is 1 in 5 of the deck
+  EXPECT_GT(drawnBombs, 100);
+  EXPECT_LT(drawnBombs, 300);
+}
+
+TEST(CardTestSuite, HandIndexesCardsByType)
+{
+  // arrange
+  Hand hand;
+  hand.addToHand(CT_Diplomacy);
+  hand.addToHand(CT_Bomb);
+  hand.addToHand(CT_Diplomacy);
+  hand.addToHand(CT_Airlift);
+
+  // assert
+  EXPECT_EQ(hand.size(), 4);
+  EXPECT_EQ(hand.getCardTypeAt(0), CT_Bomb);
+  EXPECT_EQ(hand.getCardTypeAt(1), CT_Airlift);
+  EXPECT_EQ(hand.getCardTypeAt(2), CT_Diplomacy);
+  EXPECT_EQ(hand.getCardTypeAt(3), CT_Diplomacy);
+  EXPECT_THROW(hand.getCardTypeAt(4), std::invalid_argument);
+}
+
+TEST(CardTestSuite, SeededDecksDealTheSameCards)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine first = GameEngine(argc, argv, true);
+  GameEngine second = GameEngine(argc, argv, true);
+  first.setSeed(42);
+  second.setSeed(42);
+  first.getDeck()->create_deck();
+  second.getDeck()->create_deck();
+  Hand firstHand;
+  Hand secondHand;
+
+  // act
+  std::vector<CardType> firstDraws;
+  std::vector<CardType> secondDraws;
+  for (int round = 0; round < 200; round++)
+  {
+    first.getDeck()->draw(firstHand);
+    second.getDeck()->draw(secondHand);
+    firstDraws.push_back(firstHand.getCardTypeAt(0));
+    secondDraws.push_back(secondHand.getCardTypeAt(0));
+    firstHand.removeCard(firstDraws.back());
+    secondHand.removeCard(secondDraws.back());
+    // played cards go back into the deck
+    first.getDeck()->addCardToDeck(firstDraws.back());
+    second.getDeck()->addCardToDeck(secondDraws.back());
+  }
+
+  // assert
+  EXPECT_EQ(first.getSeed(), 42);
+  EXPECT_EQ(firstDraws, secondDraws);
+  EXPECT_EQ(first.getDeck()->size(), 40);
+  // the deck was shuffled: the first 8 draws are not all of one type
+  EXPECT_NE(std::count(firstDraws.begin(), firstDraws.begin() + 8, firstDraws[0]), 8);
 }
 
 int main(int argc, char **argv)
@@ -1,7 +1,11 @@
+#include <cstdio>
+#include <fstream>
 #include <memory>
 #include <gtest/gtest.h>
 #include "GameEngine/CommandFile/FileCommandProcessorAdapter.h"
 #include "GameEngine/CommandFile/FileLineReader.h"
+#include "GameEngine/Command/CommandParser.h"
+#include "GameEngine/Command/CommandScript.h"
 #include "GameEngine/GameEngine.h"
 
 TEST(FileCommandTestSuite, CommandFile2_invalid){
@@ -114,6 +118,190 @@ TEST(FileCommandTestSuite, CommandFile4_valid){
   EXPECT_TRUE(final_state == 8);
 }
 
+TEST(FileCommandTestSuite, RejectedTournamentDoesNotLeakIntoTheNextOne){
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  const std::string commandFile = "test_rejected_tournament.txt";
+  {
+    std::ofstream out(commandFile);
+    out << "tournament -M res/TestMap1_valid.map -P Aggressive Benevolent -G 1 -D 5" << std::endl;
+    out << "tournament -M res/TestMap4_valid.map -P Cheater Neutral -G 1 -D 10" << std::endl;
+  }
+  auto game = new GameEngine(argc, argv, true);
+  FileLineReader* flr = game->getFlir();
+  FileCommandProcessorAdapter* adapter = game->getFileCommandProcessorAdapter();
+  adapter->commandLineToFile(flr);
+  flr->setFile(commandFile);
+
+  // act
+  adapter->getCommand();
+  int rejectedState = adapter->getCurrentState();
+  adapter->getCommand();
+  std::remove(commandFile.c_str());
+
+  // assert
+  EXPECT_EQ(rejectedState, GE_Start);
+  EXPECT_EQ(adapter->getCurrentState(), GE_Tournament);
+  EXPECT_EQ(game->allMaps, std::vector<std::string>({"res/TestMap4_valid.map"}));
+  EXPECT_EQ(game->allPlayerStrategies, std::vector<std::string>({"Cheater", "Neutral"}));
+  EXPECT_EQ(game->maxNumberOfTurns, 10);
+}
+
+TEST(FileCommandTestSuite, FileLineReaderStreamsEveryLine){
+
+  // arrange
+  FileLineReader flr;
+  flr.setFile("../res/TestCommand2_invalid.txt");
+  std::vector<std::string> lines;
+
+  // act
+  while(!flr.getReadComplete()){
+      lines.push_back(flr.readLineFromFile());
+  }
+
+  // assert
+  EXPECT_EQ(lines.size(), flr.maxNumberOfLines("../res/TestCommand2_invalid.txt"));
+  EXPECT_EQ(flr.getCurrentLine(), (int)lines.size() + 1);
+  EXPECT_EQ(lines.back(), "gamestart");
+  EXPECT_THROW(flr.readLineFromFile(), std::runtime_error);
+
+  // setting the file again restarts from the first line
+  flr.setFile("../res/TestCommand2_invalid.txt");
+  EXPECT_FALSE(flr.getReadComplete());
+  EXPECT_EQ(flr.readLineFromFile(), lines.front());
+}
+
+TEST(CommandParserTestSuite, ParsesTypedCommands){
+
+  // act
+  auto loadMap = CommandParser::parse("loadmap TestMap1_valid.map");
+  auto addPlayer = CommandParser::parse("addplayer  Bob ");
+  auto gameStart = CommandParser::parse("gamestart");
+  auto tournament = CommandParser::parse("tournament -M res/a.map res/b.map -P Aggressive Cheater -G 3 -D 20");
+
+  // assert
+  EXPECT_TRUE(loadMap.isValid());
+  EXPECT_EQ(loadMap.type, CMD_LoadMap);
+  EXPECT_EQ(loadMap.path, "TestMap1_valid.map");
+
+  EXPECT_TRUE(addPlayer.isValid());
+  EXPECT_EQ(addPlayer.type, CMD_AddPlayer);
+  EXPECT_EQ(addPlayer.name, "Bob");
+
+  EXPECT_TRUE(gameStart.isValid());
+  EXPECT_EQ(gameStart.type, CMD_GameStart);
+
+  EXPECT_EQ(CommandParser::parse("replay").path, "");
+  EXPECT_EQ(CommandParser::parse("replay games.wzr ").type, CMD_Replay);
+  EXPECT_EQ(CommandParser::parse("replay games.wzr ").path, "games.wzr");
+
+  EXPECT_TRUE(tournament.isValid());
+  EXPECT_EQ(tournament.type, CMD_Tournament);
+  EXPECT_EQ(tournament.maps, std::vector<std::string>({"res/a.map", "res/b.map"}));
+  EXPECT_EQ(tournament.strategies, std::vector<std::string>({"Aggressive", "Cheater"}));
+  EXPECT_EQ(tournament.games, 3);
+  EXPECT_EQ(tournament.turns, 20);
+  EXPECT_EQ(tournament.output, "");
+  EXPECT_EQ(CommandParser::parse("tournament -O out.csv -M a.map -P A B -G 1 -D 10").output, "out.csv");
+  EXPECT_EQ(CommandParser::parse("tournament -M a.map -P A B -G 1 -D 10 -F swiss").format, "swiss");
+  EXPECT_FALSE(CommandParser::parse("tournament -M a.map -P A B -G 1 -D 10 -F knockout").isValid());
+}
+
+TEST(CommandParserTestSuite, ReportsErrorPositions){
+
+  // act
+  auto badNumber = CommandParser::parse("tournament -M a.map -P A B -G x -D 20");
+  auto missingTurns = CommandParser::parse("tournament -M a.map -P A B -G 2");
+  auto notAMap = CommandParser::parse("loadmap file.txt");
+  auto unknown = CommandParser::parse("  launch");
+  auto extra = CommandParser::parse("gamestart now");
+
+  // assert
+  EXPECT_FALSE(badNumber.isValid());
+  EXPECT_EQ(badNumber.type, CMD_Tournament);
+  EXPECT_EQ(badNumber.errorPosition, 30);
+
+  EXPECT_FALSE(missingTurns.isValid());
+  EXPECT_EQ(missingTurns.errorPosition, 31);
+
+  EXPECT_FALSE(notAMap.isValid());
+  EXPECT_EQ(notAMap.errorPosition, 8);
+
+  EXPECT_FALSE(unknown.isValid());
+  EXPECT_EQ(unknown.type, CMD_Invalid);
+  EXPECT_EQ(unknown.errorPosition, 2);
+
+  EXPECT_FALSE(extra.isValid());
+  EXPECT_EQ(extra.errorPosition, 10);
+}
+
+TEST(CommandScriptTestSuite, ReportsEveryErrorBeforeRunning){
+
+  // act
+  auto script = CommandScript::fromLines({
+      "# setup",
+      "validatemap",
+      "loadmap TestMap1_valid.map",
+      "",
+      "validatemap",
+      "addplayer Bob",
+      "gamestart",
+      "tournament -M a.map -P A B -G x -D 20",
+      "quit",
+      "replay",
+  });
+
+  // assert
+  EXPECT_FALSE(script.isValid());
+  EXPECT_EQ(script.getSteps().size(), 8);
+  EXPECT_EQ(script.getErrors(), std::vector<std::string>({
+      "line 2: validatemap is not allowed in state Start",
+      "line 7: gamestart needs at least two(2) players",
+      "line 8, column 31: expected a number after -G",
+      "line 10: commands after quit are never run",
+  }));
+}
+
+TEST(CommandScriptTestSuite, RunsPlannedGamesQuietly){
+
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto script = CommandScript::fromLines({
+      "loadmap TestMap1_valid.map",
+      "validatemap",
+      "addplayer Alice",
+      "addplayer Bob",
+      "gamestart",
+      "replay",
+      "loadmap TestMap1_valid.map",
+      "validatemap",
+      "addplayer Carol",
+      "addplayer Dave",
+      "gamestart",
+  });
+  std::stringstream report;
+
+  // act
+  ASSERT_TRUE(script.isValid());
+  int games = script.execute(&gameEngine, report, "../res/");
+
+  // assert
+  EXPECT_EQ(games, 2);
+  EXPECT_EQ(gameEngine.getCurrentState(), GE_Win);
+  std::string line;
+  int lines = 0;
+  while (std::getline(report, line))
+  {
+    EXPECT_EQ(line.find("Game " + std::to_string(lines + 1) + " on TestMap1_valid.map: "), 0);
+    lines++;
+  }
+  EXPECT_EQ(lines, 2);
+}
 
 int main(int argc, char **argv)
 {
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "GameEngine/GameEngine.h"
+#include "GameEngine/TournamentScheduler.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 
 TEST(GameEngineTestSuite, GameEngineInit)
 {
@@ -17,7 +22,7 @@ TEST(GameEngineTestSuite, GameEngineInit)
   EXPECT_FALSE(gameEngine.getDeck() == nullptr);
 
   EXPECT_TRUE(gameEngine.getMap()->getTerritories()->empty());
-  EXPECT_TRUE(gameEngine.getDeck()->getDeckCards()->empty());
+  EXPECT_TRUE(gameEngine.getDeck()->empty());
   EXPECT_TRUE(gameEngine.getPlayers()->empty());
 }
 
@@ -169,9 +174,9 @@ TEST(GameEngineTestSuite, GameEngineIssueOrderPhase)
   EXPECT_FALSE(player2->getOrdersListObject()->getList()->empty());
   EXPECT_FALSE(player3->getOrdersListObject()->getList()->empty());
 
-  EXPECT_EQ(player1->getHand()->getHandCards()->size(), 0);
-  EXPECT_EQ(player2->getHand()->getHandCards()->size(), 0);
-  EXPECT_EQ(player3->getHand()->getHandCards()->size(), 0);
+  EXPECT_EQ(player1->getHand()->size(), 0);
+  EXPECT_EQ(player2->getHand()->size(), 0);
+  EXPECT_EQ(player3->getHand()->size(), 0);
 
   EXPECT_EQ(player1->getPhase(), "Issue Orders");
   EXPECT_EQ(player2->getPhase(), "Issue Orders");
@@ -246,6 +251,570 @@ TEST(GameEngineTestSuite, GameEngineExecuteOrdersPhase)
   EXPECT_EQ(player3->getPhase(), "Execute Orders Phase");
 }
 
+TEST(GameEngineTestSuite, GameEngineTracksTerritoryCounts)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto p1 = new Player(&gameEngine, new Hand(), "Bob", "Neutral");
+  auto p2 = new Player(&gameEngine, new Hand(), "Joe", "Neutral");
+  gameEngine.loadMap("res/TestMap1_valid.map");
+  auto territories = gameEngine.getMap()->getTerritories();
+
+  // act
+  for (auto t : *territories)
+  {
+    p1->addTerritory(*t);
+  }
+  int allOwned = gameEngine.getTerritoryCount(p1);
+  p2->addTerritory(*territories->at(0));
+
+  // assert
+  EXPECT_EQ(allOwned, (int)territories->size());
+  EXPECT_EQ(gameEngine.getTerritoryCount(p1), (int)territories->size() - 1);
+  EXPECT_EQ(gameEngine.getTerritoryCount(p2), 1);
+
+  p2->removeTerritory(*territories->at(0));
+  EXPECT_EQ(gameEngine.getTerritoryCount(p2), 0);
+}
+
+TEST(GameEngineTestSuite, TournamentSchedulerRunsAndResumesJobs)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  const char* outputs[] = {"scheduler_job1.txt", "scheduler_job2.txt", "scheduler_job3.txt"};
+  for (auto output : outputs)
+  {
+    std::remove(output);
+  }
+  // A stale output from another job list is replaced
+  std::ofstream(outputs[0]) << "# tournament -M other.map -P Cheater Neutral -G 1 -D 10\n";
+  TournamentScheduler scheduler(argc, argv, 2);
+  scheduler.addJob("tournament -M res/TestMap4_valid.map -P Aggressive Benevolent -G 1 -D 10", outputs[0]);
+  scheduler.addJob("tournament -M res/TestMap1_valid.map -P Cheater Neutral -G 2 -D 10", outputs[1]);
+  scheduler.addJob("tournament -M res/TestMap4_valid.map -P Benevolent Neutral -G 1 -D 10", outputs[2]);
+
+  // act
+  auto firstRun = scheduler.run();
+  auto secondRun = scheduler.run();
+
+  // assert
+  ASSERT_EQ(firstRun.size(), 3);
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_TRUE(firstRun[i].succeeded) << firstRun[i].error;
+    EXPECT_FALSE(firstRun[i].skipped);
+    EXPECT_TRUE(secondRun[i].skipped);
+
+    std::ifstream output(outputs[i]);
+    std::string header;
+    std::getline(output, header);
+    EXPECT_EQ(header, "# " + scheduler.getJobs()[i].command);
+    EXPECT_TRUE(TournamentScheduler::isComplete(scheduler.getJobs()[i]));
+  }
+  EXPECT_THROW(scheduler.addJob("loadmap TestMap1_valid.map", "unused.txt"), std::runtime_error);
+
+  for (auto output : outputs)
+  {
+    std::remove(output);
+  }
+}
+
+TEST(GameEngineTestSuite, TournamentLimitsAndStreamedResults)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  gameEngine.allMaps = {"res/TestMap4_valid.map", "res/TestMap1_valid.map"};
+  gameEngine.allPlayerStrategies = {"Cheater", "Neutral"};
+  gameEngine.numberOfGames = 7;
+  gameEngine.maxNumberOfTurns = 5;
+  gameEngine.tournamentOutputFile = "streamed_tournament.csv";
+
+  // act & assert
+  EXPECT_THROW(gameEngine.validateTournament(), std::runtime_error);
+  gameEngine.tournamentLimits = TournamentLimits::unlimited();
+  EXPECT_NO_THROW(gameEngine.validateTournament());
+
+  gameEngine.setCurrentState(GE_Tournament);
+  int games = gameEngine.runTournament();
+
+  std::ifstream csv("streamed_tournament.csv");
+  std::string line;
+  std::getline(csv, line);
+  EXPECT_EQ(line, "map,game,winner");
+  int rows = 0;
+  while (std::getline(csv, line))
+  {
+    rows++;
+  }
+  EXPECT_EQ(rows, 14);
+  EXPECT_EQ(games, 14);
+  EXPECT_NE(gameEngine.getTournamentResults().find("streamed_tournament.csv"), std::string::npos);
+
+  csv.close();
+  std::remove("streamed_tournament.csv");
+}
+
+TEST(GameEngineTestSuite, MatchmakerRatesHeadToHeadGames)
+{
+  // arrange
+  Matchmaker roundRobin({"Cheater", "Neutral", "Benevolent"}, {"res/TestMap4_valid.map"}, 2, 20, 2);
+  Matchmaker swiss({"Cheater", "Neutral", "Benevolent", "Aggressive"}, {"res/TestMap4_valid.map"}, 3, 20, 2);
+
+  // act
+  auto schedule = roundRobin.roundRobinSchedule();
+  int roundRobinGames = roundRobin.run(MF_RoundRobin);
+  int swissGamesPlayed = swiss.run(MF_Swiss);
+
+  // assert
+  EXPECT_EQ(schedule.size(), 6);
+  EXPECT_EQ(roundRobinGames, 6);
+  double totalElo = 0;
+  int decided = 0;
+  for (auto &rating : roundRobin.getRatings())
+  {
+    totalElo += rating.elo;
+    decided += rating.wins - rating.losses;
+    EXPECT_EQ(rating.wins + rating.losses + rating.draws, 4);
+  }
+  EXPECT_NEAR(totalElo, 3 * 1500, 1e-6);
+  EXPECT_EQ(decided, 0);
+  EXPECT_EQ(roundRobin.getLeaderboard().find("1     Cheater"), roundRobin.getLeaderboard().find('\n') + 1);
+
+  int swissGames = 0;
+  for (auto &rating : swiss.getRatings())
+  {
+    swissGames += rating.wins + rating.losses + rating.draws;
+  }
+  EXPECT_EQ(swissGames, 3 * 2 * 2);
+  EXPECT_EQ(swissGamesPlayed, 3 * 2);
+  EXPECT_THROW(Matchmaker({"Cheater", "Cheater"}, {"res/TestMap4_valid.map"}, 1, 10), std::runtime_error);
+  EXPECT_NEAR(Matchmaker::expectedScore(1500, 1500), 0.5, 1e-9);
+}
+
+TEST(GameEngineTestSuite, PassiveGamesEndInStalemate)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+
+  // act
+  std::string passive = gameEngine.playGame("res/TestMap4_valid.map", {"Benevolent", "Neutral"}, 500);
+  int passiveRounds = gameEngine.getRoundsPlayed();
+  gameEngine.stalemateRounds = 0;
+  gameEngine.playGame("res/TestMap4_valid.map", {"Benevolent", "Neutral"}, 50);
+  int undetectedRounds = gameEngine.getRoundsPlayed();
+  gameEngine.stalemateRounds = 5;
+  std::string cheater = gameEngine.playGame("res/TestMap4_valid.map", {"Cheater", "Neutral"}, 500);
+
+  // assert
+  EXPECT_EQ(passive, "draw");
+  EXPECT_LT(passiveRounds, 50);
+  EXPECT_EQ(undetectedRounds, 51);
+  EXPECT_EQ(cheater, "Cheater");
+}
+
+TEST(GameEngineTestSuite, BatchedDeploysMatchSequentialExecution)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine batched = GameEngine(argc, argv, true);
+  GameEngine sequential = GameEngine(argc, argv, true);
+  sequential.batchDeploys = false;
+
+  for (GameEngine* gameEngine : {&batched, &sequential})
+  {
+    // arrange
+    gameEngine->loadMap("res/TestMap1_valid.map");
+    auto territories = gameEngine->getMap()->getTerritories();
+    auto home = territories->at(0);
+    auto neighbour = home->getAdjacentTerritories()->at(0);
+    Territory* other = nullptr;
+    for (auto territory : *territories)
+    {
+      if (territory != home && territory != neighbour)
+      {
+        other = territory;
+        break;
+      }
+    }
+    auto p1 = new Player(gameEngine, new Hand(), "Bob", "Neutral");
+    auto p2 = new Player(gameEngine, new Hand(), "Joe", "Neutral");
+    p1->addTerritory(*home);
+    p1->addTerritory(*neighbour);
+    p2->addTerritory(*other);
+    p1->setReinforcementPool(10);
+    p2->setReinforcementPool(5);
+
+    // two valid deploys on the same territory, one over the remaining pool, then a transfer that needs them
+    p1->getOrdersListObject()->add(new Deploy(gameEngine, home, p1, 3));
+    p1->getOrdersListObject()->add(new Deploy(gameEngine, home, p1, 4));
+    p1->getOrdersListObject()->add(new Deploy(gameEngine, neighbour, p1, 4));
+    p1->getOrdersListObject()->add(new Advance(gameEngine, home, neighbour, p1, 6));
+    p1->getOrdersListObject()->add(new Deploy(gameEngine, neighbour, p1, 3));
+    // a deploy on a territory the player does not own is skipped
+    p2->getOrdersListObject()->add(new Deploy(gameEngine, home, p2, 2));
+    p2->getOrdersListObject()->add(new Deploy(gameEngine, other, p2, 5));
+
+    // act
+    gameEngine->executeOrdersPhase();
+  }
+
+  // assert
+  auto batchedTerritories = batched.getMap()->getTerritories();
+  auto sequentialTerritories = sequential.getMap()->getTerritories();
+  for (size_t i = 0; i < batchedTerritories->size(); i++)
+  {
+    EXPECT_EQ(batchedTerritories->at(i)->getArmies(), sequentialTerritories->at(i)->getArmies());
+  }
+  for (size_t i = 0; i < batched.getPlayers()->size(); i++)
+  {
+    EXPECT_EQ(batched.getPlayers()->at(i)->getReinforcementPool(), sequential.getPlayers()->at(i)->getReinforcementPool());
+    EXPECT_TRUE(batched.getPlayers()->at(i)->getOrdersListObject()->getList()->empty());
+  }
+  EXPECT_EQ(batched.getStateHash(), sequential.getStateHash());
+  EXPECT_EQ(batchedTerritories->at(0)->getArmies(), 1);
+  EXPECT_EQ(batched.getPlayers()->at(0)->getReinforcementPool(), 0);
+}
+
+TEST(GameEngineTestSuite, RecordedGamesPlayBackToTheSameResult)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  const std::string replayFile = "test_replay.wzr";
+  gameEngine.setSeed(7);
+  gameEngine.recordReplays(replayFile);
+
+  // act
+  std::string cheater = gameEngine.playGame("res/TestMap4_valid.map", {"Cheater", "Neutral"}, 500);
+  int cheaterRounds = gameEngine.getRoundsPlayed();
+  std::string aggressive = gameEngine.playGame("res/TestMap1_valid.map", {"Aggressive", "Benevolent"}, 30);
+  int aggressiveRounds = gameEngine.getRoundsPlayed();
+  gameEngine.recordReplays("");
+  auto games = ReplayPlayer::playFile(replayFile);
+
+  std::ifstream file(replayFile, std::ios::binary);
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  file.close();
+  std::remove(replayFile.c_str());
+
+  // assert
+  ASSERT_EQ(games.size(), 2);
+  // Every game records the seed it started from, drawn from the engine's
+  EXPECT_NE(games[0].seed, games[1].seed);
+  EXPECT_EQ(games[0].players, std::vector<std::string>({"Cheater", "Neutral"}));
+  EXPECT_TRUE(games[0].finished);
+  EXPECT_TRUE(games[0].verified);
+  EXPECT_EQ(games[0].players.at(games[0].winner), cheater);
+  EXPECT_EQ(games[0].rounds, cheaterRounds);
+  for (int32_t owner : games[0].owner)
+  {
+    EXPECT_EQ(owner, games[0].winner);
+  }
+
+  EXPECT_TRUE(games[1].finished);
+  EXPECT_TRUE(games[1].verified);
+  EXPECT_EQ(games[1].winner < 0 ? "draw" : games[1].players.at(games[1].winner), aggressive);
+  EXPECT_EQ(games[1].rounds, aggressiveRounds);
+  EXPECT_GT(games[1].orders, 0);
+  EXPECT_EQ(games[1].issued.size(), (size_t)games[1].orders);
+  auto deploy = std::find_if(games[1].issued.begin(), games[1].issued.end(), [](const ReplayOrder &order)
+                             { return order.event == RE_Deploy; });
+  ASSERT_NE(deploy, games[1].issued.end());
+  EXPECT_GE(deploy->target, 0);
+  EXPECT_GT(deploy->armies, 0);
+
+  std::vector<uint8_t> cut(data.begin(), data.end() - 3);
+  EXPECT_THROW(ReplayPlayer::play(cut), std::runtime_error);
+  EXPECT_THROW(ReplayPlayer::play(std::vector<uint8_t>({'W', 'Z'})), std::runtime_error);
+}
+
+TEST(GameEngineTestSuite, CrashedGamesKeepTheirCompletedRounds)
+{
+  // arrange
+  const std::string replayFile = "test_crashed_replay.wzr";
+  TerritoryStore store;
+  store.add(3, 0, -1);
+  store.add(2, 1, -1);
+
+  // act
+  {
+    ReplayRecorder recorder;
+    recorder.open(replayFile);
+    recorder.beginGame(1, "Two", {"Bob", "Joe"}, store);
+    recorder.beginRound(0);
+    store.setArmies(0, 8);
+    recorder.record({RE_Deploy, 0, -1, 0, 5}, store);
+    store.setOwner(1, 0);
+    store.setArmies(1, 4);
+    recorder.record({RE_Advance, 0, 0, 1, 6}, store);
+    recorder.beginRound(1);
+    // lost with the crash: the round is only written out once complete
+    store.setArmies(1, 9);
+    recorder.record({RE_Deploy, 0, -1, 1, 5}, store);
+  }
+  auto games = ReplayPlayer::playFile(replayFile);
+  std::remove(replayFile.c_str());
+
+  // assert
+  ASSERT_EQ(games.size(), 1);
+  EXPECT_FALSE(games[0].finished);
+  EXPECT_FALSE(games[0].verified);
+  EXPECT_EQ(games[0].rounds, 1);
+  EXPECT_EQ(games[0].orders, 2);
+  ASSERT_EQ(games[0].issued.size(), 2);
+  EXPECT_EQ(games[0].issued[1].event, RE_Advance);
+  EXPECT_EQ(games[0].issued[1].source, 0);
+  EXPECT_EQ(games[0].issued[1].target, 1);
+  EXPECT_EQ(games[0].issued[1].armies, 6);
+  EXPECT_EQ(games[0].owner, std::vector<int32_t>({0, 0}));
+  EXPECT_EQ(games[0].armies, std::vector<int32_t>({8, 4}));
+}
+
+TEST(GameEngineTestSuite, CapturedGamesAreRestoredOnAFreshEngine)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  GameEngine original = GameEngine(argc, argv, true);
+  original.setSeed(3);
+  original.loadMap("res/TestMap1_valid.map");
+  original.validateMap();
+  new Player(&original, new Hand(), "Bob", "Aggressive");
+  new Player(&original, new Hand(), "Joe", "Benevolent");
+  new Player(&original, new Hand(), "Tom", "Neutral");
+  original.startGame();
+
+  // act
+  GameSnapshot snapshot = original.captureGame(4, 1);
+  GameEngine restored = GameEngine(argc, argv, true);
+  restored.loadMap("res/TestMap1_valid.map");
+  restored.validateMap();
+  restored.restoreGame(snapshot);
+  GameSnapshot again = restored.captureGame(4, 1);
+
+  // assert
+  EXPECT_EQ(restored.getMap()->getStore()->hash(), original.getMap()->getStore()->hash());
+  ASSERT_EQ(again.players.size(), 3);
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_EQ(again.players[i].id, original.getPlayers()->at(i)->getId());
+    EXPECT_EQ(again.players[i].name, snapshot.players[i].name);
+    EXPECT_EQ(again.players[i].strategy, snapshot.players[i].strategy);
+    EXPECT_EQ(again.players[i].reinforcementPool, 50);
+    EXPECT_EQ(again.players[i].hand, snapshot.players[i].hand);
+  }
+  EXPECT_EQ(again.deck, snapshot.deck);
+  EXPECT_EQ(again.rng, snapshot.rng);
+  EXPECT_EQ(restored.getDeck()->size(), original.getDeck()->size());
+
+  GameSnapshot otherMap = snapshot;
+  otherMap.armies.pop_back();
+  GameEngine wrongMap = GameEngine(argc, argv, true);
+  wrongMap.loadMap("res/TestMap1_valid.map");
+  EXPECT_THROW(wrongMap.restoreGame(otherMap), std::runtime_error);
+}
+
+TEST(GameEngineTestSuite, ResumedTournamentsSkipFinishedGames)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  const std::string checkpointFile = "test_tournament.wzc";
+  GameEngine source = GameEngine(argc, argv, true);
+  source.loadMap("res/TestMap4_valid.map");
+  source.validateMap();
+  new Player(&source, new Hand(), "Cheater", "Cheater");
+  new Player(&source, new Hand(), "Neutral", "Neutral");
+  source.startGame();
+
+  // A run that finished game 1 and was killed during game 2
+  TournamentCheckpoint crashed;
+  crashed.maps = {"res/TestMap4_valid.map"};
+  crashed.strategies = {"Cheater", "Neutral"};
+  crashed.games = 3;
+  crashed.maxTurns = 50;
+  crashed.addResult(0, 0, "Neutral");
+  crashed.hasGame = true;
+  crashed.gameNumber = 1;
+  crashed.game = source.captureGame(2, 0);
+  // Its results file holds game 1, then part of a row written after the checkpoint
+  const std::string resultsFile = "test_resumed_tournament.csv";
+  const std::string savedRows = "map,game,winner\nres/TestMap4_valid.map,1,Neutral\n";
+  std::ofstream(resultsFile, std::ios::out | std::ios::binary) << savedRows << "res/TestMap4_valid.map,2,Ch";
+  crashed.outputBytes = savedRows.size();
+  crashed.save(checkpointFile);
+  TournamentCheckpoint loaded = TournamentCheckpoint::load(checkpointFile);
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  gameEngine.allMaps = crashed.maps;
+  gameEngine.allPlayerStrategies = crashed.strategies;
+  gameEngine.numberOfGames = crashed.games;
+  gameEngine.maxNumberOfTurns = crashed.maxTurns;
+  gameEngine.tournamentOutputFile = resultsFile;
+  gameEngine.checkpointFile = checkpointFile;
+  gameEngine.resumeTournament = true;
+
+  // act
+  gameEngine.setCurrentState(GE_Tournament);
+  gameEngine.runTournament();
+  TournamentCheckpoint finished = TournamentCheckpoint::load(checkpointFile);
+
+  std::ifstream csv(resultsFile);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(csv, line);)
+  {
+    lines.push_back(line);
+  }
+  csv.close();
+
+  GameEngine other = GameEngine(argc, argv, true);
+  other.allMaps = crashed.maps;
+  other.allPlayerStrategies = {"Cheater", "Aggressive"};
+  other.numberOfGames = crashed.games;
+  other.maxNumberOfTurns = crashed.maxTurns;
+  other.checkpointFile = checkpointFile;
+  other.resumeTournament = true;
+  other.setCurrentState(GE_Tournament);
+  EXPECT_THROW(other.runTournament(), std::runtime_error);
+
+  std::remove(checkpointFile.c_str());
+  std::remove(resultsFile.c_str());
+
+  // assert
+  EXPECT_TRUE(loaded.sameTournament(crashed));
+  EXPECT_TRUE(loaded.hasGame);
+  EXPECT_EQ(loaded.game.round, 2);
+  EXPECT_EQ(loaded.game.owner, crashed.game.owner);
+  EXPECT_EQ(loaded.game.deck, crashed.game.deck);
+  EXPECT_EQ(loaded.game.players[1].hand, crashed.game.players[1].hand);
+
+  EXPECT_FALSE(finished.hasGame);
+  EXPECT_EQ(finished.nextMap, 0);
+  EXPECT_EQ(finished.nextGame, 3);
+  EXPECT_EQ(finished.wins, (std::map<std::string, int32_t>{{"Cheater", 2}, {"Neutral", 1}}));
+  // The summary counts the games of both runs
+  EXPECT_NE(gameEngine.getTournamentResults().find("Neutral        1"), std::string::npos);
+  ASSERT_EQ(lines.size(), 4);
+  // Game 1 is kept from the earlier run rather than played again, and its partial row is dropped
+  EXPECT_EQ(lines[0], "map,game,winner");
+  EXPECT_EQ(lines[1], "res/TestMap4_valid.map,1,Neutral");
+  EXPECT_EQ(lines[2], "res/TestMap4_valid.map,2,Cheater");
+  EXPECT_EQ(lines[3], "res/TestMap4_valid.map,3,Cheater");
+}
+
+TEST(GameEngineTestSuite, CheckpointsReplaceEarlierSavesAndRejectCorruptCounts)
+{
+  // arrange
+  const std::string checkpointFile = "test_checkpoint_twice.wzc";
+  TournamentCheckpoint first;
+  first.maps = {"res/TestMap4_valid.map"};
+  first.strategies = {"Cheater", "Neutral"};
+  first.games = 2;
+  first.maxTurns = 50;
+  TournamentCheckpoint second = first;
+  second.addResult(0, 0, "Cheater");
+
+  // A checkpoint claiming a billion winners in a handful of bytes
+  BinaryWriter corrupt;
+  corrupt.bytes.append(TournamentCheckpoint::MAGIC, sizeof(TournamentCheckpoint::MAGIC));
+  corrupt.byte(TournamentCheckpoint::VERSION);
+  corrupt.varint(0);
+  corrupt.varint(0);
+  corrupt.varint(1);
+  corrupt.varint(50);
+  corrupt.varint(0);
+  corrupt.varint(0);
+  corrupt.varint(0);
+  corrupt.varint(1000000000);
+  const std::string corruptFile = "test_checkpoint_corrupt.wzc";
+  std::ofstream(corruptFile, std::ios::out | std::ios::binary) << corrupt.bytes;
+
+  // act
+  first.save(checkpointFile);
+  second.save(checkpointFile);
+  TournamentCheckpoint loaded = TournamentCheckpoint::load(checkpointFile);
+
+  // assert
+  EXPECT_EQ(loaded.nextGame, 1);
+  EXPECT_EQ(loaded.wins, (std::map<std::string, int32_t>{{"Cheater", 1}}));
+  EXPECT_THROW(TournamentCheckpoint::load(corruptFile), std::runtime_error);
+
+  std::remove(checkpointFile.c_str());
+  std::remove(corruptFile.c_str());
+}
+
+TEST(GameEngineTestSuite, SeededGamesPlayTheSameWay)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  GameEngine first = GameEngine(argc, argv, true);
+  GameEngine second = GameEngine(argc, argv, true);
+  first.setSeed(11);
+  second.setSeed(11);
+
+  // act
+  std::string firstWinner = first.playGame("res/TestMap1_valid.map", {"Aggressive", "Benevolent", "Random"}, 30);
+  std::string secondWinner = second.playGame("res/TestMap1_valid.map", {"Aggressive", "Benevolent", "Random"}, 30);
+
+  // assert
+  EXPECT_EQ(firstWinner, secondWinner);
+  EXPECT_EQ(first.getRoundsPlayed(), second.getRoundsPlayed());
+  EXPECT_EQ(first.getMap()->getStore()->hash(), second.getMap()->getStore()->hash());
+}
+
+TEST(GameEngineTestSuite, TournamentGamesReplayFromTheirRecordedSeed)
+{
+  // arrange
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  const std::string tournamentReplay = "test_tournament_replay.wzr";
+  const std::string gameReplay = "test_game_replay.wzr";
+  GameEngine tournament = GameEngine(argc, argv, true);
+  tournament.setSeed(5);
+  tournament.recordReplays(tournamentReplay);
+  tournament.allMaps = {"res/TestMap1_valid.map"};
+  tournament.allPlayerStrategies = {"Aggressive", "Benevolent"};
+  tournament.numberOfGames = 3;
+  tournament.maxNumberOfTurns = 30;
+  tournament.setCurrentState(GE_Tournament);
+  tournament.runTournament();
+  tournament.recordReplays("");
+  auto games = ReplayPlayer::playFile(tournamentReplay);
+
+  // act
+  ASSERT_EQ(games.size(), 3);
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  gameEngine.recordReplays(gameReplay);
+  gameEngine.playSeededGame(games[2].seed, "res/TestMap1_valid.map", {"Aggressive", "Benevolent"}, 30);
+  gameEngine.recordReplays("");
+  auto again = ReplayPlayer::playFile(gameReplay);
+
+  std::remove(tournamentReplay.c_str());
+  std::remove(gameReplay.c_str());
+
+  // assert
+  EXPECT_NE(games[1].seed, games[2].seed);
+  ASSERT_EQ(again.size(), 1);
+  EXPECT_EQ(again[0].seed, games[2].seed);
+  EXPECT_TRUE(again[0].verified);
+  EXPECT_EQ(again[0].hash, games[2].hash);
+  EXPECT_EQ(again[0].rounds, games[2].rounds);
+  EXPECT_EQ(again[0].orders, games[2].orders);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
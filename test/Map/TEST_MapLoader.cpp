@@ -197,8 +197,431 @@ TEST(MaploaderTestSuite, TestMap5LoadInvalidFormat){
   EXPECT_FALSE(isValid);
 }
 
+TEST(MapLoaderTestSuite, TestMap1AssignsDenseIds)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto map = gameEngine.getMap();
+
+  // act
+  MapLoader::load("../res/TestMap1_valid.map", map);
+
+  // assert
+  auto territories = map->getTerritories();
+  for(int i = 0; i < (int)territories->size(); i++){
+    EXPECT_EQ(territories->at(i)->getId(), i);
+    EXPECT_EQ(map->getTerritoryById(i), territories->at(i));
+  }
+
+  auto continents = map->getContinents();
+  for(int i = 0; i < (int)continents->size(); i++){
+    EXPECT_EQ(continents->at(i)->getId(), i);
+    EXPECT_EQ(map->getContinentById(i), continents->at(i));
+  }
+}
+
+TEST(MapLoaderTestSuite, TestMap1TerritoryStateLivesInStore)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto player = new Player(&gameEngine, new Hand(), "Bob", "Neutral");
+  auto map = gameEngine.getMap();
+  MapLoader::load("../res/TestMap1_valid.map", map);
+  auto territories = map->getTerritories();
+  auto store = map->getStore();
+
+  // act
+  territories->at(0)->setArmies(5);
+  territories->at(1)->setArmies(7);
+  player->addTerritory(*territories->at(0));
+  player->addTerritory(*territories->at(1));
+  store->addArmiesWhereOwner(player->getId(), 2);
+
+  // assert
+  EXPECT_EQ(store->size(), (int)territories->size());
+  EXPECT_EQ(store->countByOwner(player->getId()), 2);
+  EXPECT_EQ(store->sumArmiesByOwner(player->getId()), 16);
+  EXPECT_EQ(territories->at(0)->getArmies(), 7);
+  EXPECT_EQ(territories->at(1)->getPlayer(), player);
+  EXPECT_EQ(store->countByOwner(TerritoryStore::NEUTRAL), (int)territories->size() - 2);
+  EXPECT_EQ(store->continent[0], territories->at(0)->getContinent()->getId());
+}
+
+TEST(MapLoaderTestSuite, TestMap1CloneIsDeep)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto map = gameEngine.getMap();
+  MapLoader::load("../res/TestMap1_valid.map", map);
+
+  // act
+  std::unique_ptr<Map> copy(map->clone(&gameEngine));
+  copy->getTerritories()->at(0)->setArmies(42);
+
+  // assert
+  EXPECT_TRUE(copy->validate());
+  EXPECT_EQ(copy->getName(), map->getName());
+  EXPECT_EQ(copy->getTerritories()->size(), map->getTerritories()->size());
+  EXPECT_EQ(copy->getContinents()->size(), map->getContinents()->size());
+  EXPECT_EQ(map->getTerritories()->at(0)->getArmies(), 0);
+
+  for(size_t i = 0; i < copy->getTerritories()->size(); i++){
+    auto original = map->getTerritories()->at(i);
+    auto territory = copy->getTerritories()->at(i);
+    EXPECT_NE(territory, original);
+    EXPECT_EQ(territory->getName(), original->getName());
+    EXPECT_EQ(territory->getContinent(), copy->getContinentById(original->getContinent()->getId()));
+    ASSERT_EQ(territory->getAdjacentTerritories()->size(), original->getAdjacentTerritories()->size());
+    for(size_t j = 0; j < territory->getAdjacentTerritories()->size(); j++){
+      EXPECT_EQ(territory->getAdjacentTerritories()->at(j), copy->getTerritoryById(original->getAdjacentTerritories()->at(j)->getId()));
+    }
+  }
+}
+
+TEST(MapLoaderTestSuite, TestMap1KeepsIncrementalZobristHash)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto player = new Player(&gameEngine, new Hand(), "Bob", "Neutral");
+  auto map = gameEngine.getMap();
+  MapLoader::load("../res/TestMap1_valid.map", map);
+  auto territories = map->getTerritories();
+  auto store = map->getStore();
+  uint64_t initial = gameEngine.getStateHash();
+
+  // act & assert
+  territories->at(0)->setArmies(3);
+  player->addTerritory(*territories->at(0));
+  EXPECT_NE(gameEngine.getStateHash(), initial);
+  EXPECT_EQ(store->hash(), store->computeHash());
+
+  // army counts in the same bucket hash the same
+  territories->at(1)->setArmies(40);
+  uint64_t forty = store->hash();
+  territories->at(1)->addArmyUnits(1);
+  EXPECT_EQ(store->hash(), forty);
+  store->addArmiesWhereOwner(player->getId(), 30);
+  EXPECT_EQ(store->hash(), store->computeHash());
+
+  // undoing every change gives the initial position back
+  player->removeTerritory(*territories->at(0));
+  territories->at(0)->setArmies(0);
+  territories->at(1)->setArmies(0);
+  EXPECT_EQ(gameEngine.getStateHash(), initial);
+
+  gameEngine.setCurrentState(GE_Map_Loaded);
+  EXPECT_NE(gameEngine.getStateHash(), initial);
+}
+
+TEST(MapLoaderTestSuite, TestMap1DistanceOracleMatchesOnDemandBfs)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto map = gameEngine.getMap();
+  MapLoader::load("../res/TestMap1_valid.map", map);
+  auto territories = map->getTerritories();
+  int size = (int)territories->size();
+
+  std::vector<int32_t> start(1, 0), neighbours;
+  for (auto territory : *territories)
+  {
+    for (auto adjacent : *territory->getAdjacentTerritories())
+    {
+      neighbours.push_back(adjacent->getId());
+    }
+    start.push_back((int32_t)neighbours.size());
+  }
+  // too few territories for full tables and a tiny cache, so rows are evicted and recomputed
+  DistanceOracle onDemand;
+  onDemand.build(start, neighbours, 1, 0, 3);
+
+  // act
+  const DistanceOracle &oracle = map->getDistanceOracle();
+
+  // assert
+  EXPECT_TRUE(oracle.hasFullTables());
+  EXPECT_FALSE(onDemand.hasFullTables());
+  EXPECT_EQ(oracle.size(), size);
+  for (int from = 0; from < size; from++)
+  {
+    EXPECT_EQ(oracle.distance(from, from), 0);
+    EXPECT_EQ(oracle.nextHop(from, from), from);
+    for (auto adjacent : *territories->at(from)->getAdjacentTerritories())
+    {
+      EXPECT_EQ(oracle.distance(from, adjacent->getId()), 1);
+    }
+    for (int to = 0; to < size; to++)
+    {
+      int distance = oracle.distance(from, to);
+      ASSERT_GE(distance, 0);
+      EXPECT_EQ(onDemand.distance(from, to), distance);
+      if (from != to)
+      {
+        // the next hop is a neighbour one step closer
+        int next = oracle.nextHop(from, to);
+        EXPECT_TRUE(map->getNeighbourSet(from).test(next));
+        EXPECT_EQ(oracle.distance(next, to), distance - 1);
+        EXPECT_EQ(onDemand.distance(onDemand.nextHop(from, to), to), distance - 1);
+      }
+    }
+  }
+
+  // the field toward a set gives the distance to its nearest member
+  TerritorySet targets(size);
+  targets.set(0);
+  targets.set(size - 1);
+  DistanceField field = oracle.towards(targets);
+  for (int from = 0; from < size; from++)
+  {
+    EXPECT_EQ(field.distance(from), std::min(oracle.distance(from, 0), oracle.distance(from, size - 1)));
+    if (field.distance(from) > 0)
+    {
+      EXPECT_EQ(field.distance(field.nextHop(from)), field.distance(from) - 1);
+    }
+  }
+
+  // an edge added after loading is seen by every adjacency query
+  int far = 1;
+  while (far < size && oracle.distance(0, far) < 2)
+  {
+    far++;
+  }
+  ASSERT_LT(far, size);
+  territories->at(0)->addAdjacentTerritory(territories->at(far));
+  EXPECT_EQ(map->getDistanceOracle().distance(0, far), 1);
+  EXPECT_EQ(map->getDistanceOracle().nextHop(0, far), far);
+  EXPECT_TRUE(map->getNeighbourSet(0).test(far));
+  EXPECT_TRUE(map->areAdjacent(0, far));
+}
+
+TEST(MapLoaderTestSuite, TerritoryStoreKernelsMatchScalar)
+{
+  // arrange
+  // a size that is not a multiple of 8, so the scalar tail runs too
+  TerritoryStore store;
+  uint64_t rng = 7;
+  for (int i = 0; i < 1003; i++)
+  {
+    rng = TerritoryStore::mixKey(rng);
+    // armies around the bucket edges of 8 and 16, owners 0 to 5 and neutral
+    store.add((int32_t)(rng % 20), (int32_t)((rng >> 20) % 7) - 1, (int32_t)((rng >> 40) % 4));
+  }
+  TerritoryStore scalar = store;
+  bool vectorized = TerritoryStore::isVectorized();
+
+  for (int owner = -1; owner < 6; owner++)
+  {
+    // act
+    TerritoryStore::setVectorized(true);
+    int count = store.countByOwner(owner);
+    int sum = store.sumArmiesByOwner(owner);
+    store.addArmiesWhereOwner(owner, owner + 2);
+    TerritoryStore::setVectorized(false);
+    int scalarCount = scalar.countByOwner(owner);
+    int scalarSum = scalar.sumArmiesByOwner(owner);
+    scalar.addArmiesWhereOwner(owner, owner + 2);
+
+    // assert
+    EXPECT_EQ(count, scalarCount);
+    EXPECT_EQ(sum, scalarSum);
+    EXPECT_EQ(store.armies, scalar.armies);
+    EXPECT_EQ(store.hash(), store.computeHash());
+    EXPECT_EQ(store.hash(), scalar.hash());
+  }
+
+  TerritoryStore::setVectorized(true);
+  auto counts = store.countsByOwner(6);
+  auto armies = store.armiesByOwner(6);
+  TerritoryStore::setVectorized(false);
+  EXPECT_EQ(counts, scalar.countsByOwner(6));
+  EXPECT_EQ(armies, scalar.armiesByOwner(6));
+  auto perContinent = scalar.countsByOwnerAndContinent(6, 4);
+  for (int owner = 0; owner < 6; owner++)
+  {
+    EXPECT_EQ(std::vector<int>(perContinent.begin() + owner * 4, perContinent.begin() + owner * 4 + 4),
+              scalar.countsByContinentForOwner(owner, 4));
+    EXPECT_EQ(armies[owner], scalar.sumArmiesByOwner(owner));
+  }
+
+  // both kernels list the territories they change, each once
+  store.setTracking(true);
+  scalar.setTracking(true);
+  TerritoryStore::setVectorized(true);
+  store.addArmiesWhereOwner(2, 1);
+  TerritoryStore::setVectorized(false);
+  scalar.addArmiesWhereOwner(2, 1);
+  EXPECT_EQ(store.getChanged(), scalar.getChanged());
+  EXPECT_EQ((int)scalar.getChanged().size(), scalar.countByOwner(2));
+  scalar.clearChanged();
+  scalar.setArmies(0, 5);
+  scalar.setOwner(0, 1);
+  EXPECT_EQ(scalar.getChanged(), std::vector<int32_t>({0}));
+  TerritoryStore::setVectorized(vectorized);
+}
+
+TEST(MapLoaderTestSuite, TestMap1EdgeIndexMatchesAdjacencyLists)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto map = gameEngine.getMap();
+  MapLoader::load("../res/TestMap1_valid.map", map);
+  auto territories = map->getTerritories();
+  int size = (int)territories->size();
+
+  // act & assert
+  for (int from = 0; from < size; from++)
+  {
+    auto adjacent = territories->at(from)->getAdjacentTerritories();
+    for (int to = 0; to < size; to++)
+    {
+      bool listed = std::find(adjacent->begin(), adjacent->end(), territories->at(to)) != adjacent->end();
+      EXPECT_EQ(map->areAdjacent(from, to), listed);
+      EXPECT_EQ(territories->at(from)->isAdjacent(territories->at(to)), listed);
+    }
+  }
+
+  // an edge added after loading is seen by the next query
+  Territory* first = territories->at(0);
+  Territory* last = territories->at(size - 1);
+  if (!first->isAdjacent(last))
+  {
+    first->addAdjacentTerritory(last);
+    EXPECT_TRUE(first->isAdjacent(last));
+  }
+
+  // duplicate edges are stored once, and edges are directed
+  EdgeIndex index;
+  index.build({0, 3, 3}, {1, 1, 0});
+  EXPECT_EQ(index.edgeCount(), 2);
+  EXPECT_TRUE(index.contains(0, 1));
+  EXPECT_FALSE(index.contains(1, 0));
+  EXPECT_FALSE(index.contains(-1, 0));
+}
+
+TEST(MapLoaderTestSuite, TestMap1LivesInTheMapArena)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto map = gameEngine.getMap();
+  MapLoader::load("../res/TestMap1_valid.map", map);
+
+  // act
+  std::unique_ptr<Map> copy(map->clone(&gameEngine));
+  size_t loadedBytes = map->getArena().bytesUsed();
+  *map = Map(&gameEngine);
+
+  // assert
+  EXPECT_GT(loadedBytes, map->getTerritories()->size() * sizeof(Territory));
+  EXPECT_EQ(map->getArena().blockCount(), 0);
+  EXPECT_EQ(map->getArena().bytesUsed(), 0);
+  EXPECT_EQ(copy->getArena().blockCount(), 1);
+  EXPECT_TRUE(copy->validate());
+  for (auto territory : *copy->getTerritories())
+  {
+    EXPECT_EQ(territory->getAdjacentTerritories()->get_allocator().arena, &copy->getArena());
+  }
+
+  // allocations are aligned and blocks grow as needed
+  MapArena arena;
+  auto small = static_cast<char*>(arena.allocate(3, 1));
+  auto aligned = arena.allocate(sizeof(double), alignof(double));
+  EXPECT_EQ((uintptr_t)aligned % alignof(double), 0);
+  arena.allocate(MapArena::FIRST_BLOCK_SIZE * 3, 8);
+  EXPECT_EQ(arena.blockCount(), 2);
+  EXPECT_GE(arena.bytesReserved(), MapArena::FIRST_BLOCK_SIZE * 4);
+  small[0] = 'x';
+  arena.release();
+  EXPECT_EQ(arena.blockCount(), 0);
+  EXPECT_EQ(arena.bytesReserved(), 0);
+}
+
+TEST(MapLoaderTestSuite, TestMap1NamesAreInterned)
+{
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  // arrange
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto map = gameEngine.getMap();
+  MapLoader::load("../res/TestMap1_valid.map", map);
+
+  // act
+  std::unique_ptr<Map> copy(map->clone(&gameEngine));
+  auto symbols = map->getSymbols();
+
+  // assert
+  EXPECT_EQ(symbols->size(), map->getTerritories()->size() + map->getContinents()->size());
+  for (size_t i = 0; i < map->getTerritories()->size(); i++)
+  {
+    auto territory = map->getTerritories()->at(i);
+    EXPECT_EQ(symbols->find(territory->getName()), territory->getNameSymbol());
+    EXPECT_EQ(symbols->text(territory->getNameSymbol()), territory->getName());
+    EXPECT_EQ(copy->getTerritories()->at(i)->getNameSymbol(), territory->getNameSymbol());
+    EXPECT_EQ(copy->getTerritories()->at(i)->getName(), territory->getName());
+    for (auto adjacent : *territory->getAdjacentTerritories())
+    {
+      EXPECT_NE(adjacent->getNameSymbol(), territory->getNameSymbol());
+    }
+  }
+  for (auto continent : *map->getContinents())
+  {
+    EXPECT_EQ(symbols->find(continent->getName()), continent->getNameSymbol());
+  }
+
+  // symbols are dense and stable while the table grows
+  SymbolTable table;
+  for (int i = 0; i < 1000; i++)
+  {
+    EXPECT_EQ(table.intern("Name" + std::to_string(i)), (uint32_t)i);
+  }
+  EXPECT_EQ(table.intern("Name500"), 500);
+  EXPECT_EQ(table.intern(std::string("")), 1000);
+  EXPECT_EQ(table.find("Name999"), 999);
+  EXPECT_EQ(table.find("Name1000"), SymbolTable::NONE);
+  EXPECT_STREQ(table.c_str(42), "Name42");
+  EXPECT_EQ(table.length(1000), 0);
+  table.clear();
+  EXPECT_EQ(table.size(), 0);
+  EXPECT_EQ(table.find("Name1"), SymbolTable::NONE);
+
+  // player names are interned by their game
+  auto first = new Player(&gameEngine, new Hand(), "Bob", "Neutral");
+  auto second = new Player(&gameEngine, new Hand(), "Bob", "Neutral");
+  EXPECT_EQ(first->getNameSymbol(), second->getNameSymbol());
+  EXPECT_EQ(second->getName(), "Bob");
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
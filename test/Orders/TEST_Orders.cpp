@@ -12,6 +12,8 @@ TEST(OrdersListSuite, listAddOrders)
 
   // create a game engine
   auto gameEngine = GameEngine(argc, argv, true);
+  // the Aggressive players pick their orders at random
+  gameEngine.setSeed(1);
 
   // add cards to the gameEngine deck
   auto deck = gameEngine.getDeck();
@@ -74,8 +76,8 @@ TEST(OrdersListSuite, listAddOrders)
   // issue orders
 
   gameEngine.setCurrentPlayer(player1);
-  while(!player1->getHand()->getCards()->empty()){
-    player1->getHand()->getHandCards()->at(0)->play();
+  while(!player1->getHand()->empty()){
+    Card(player1->getHand()->getCardTypeAt(0), &gameEngine).play();
   }
 
   // assert
@@ -92,6 +94,8 @@ TEST(OrdersListSuite, listRemoveOrder)
 
   // create a game engine
   auto gameEngine = GameEngine(argc, argv, true);
+  // the Aggressive players pick their orders at random
+  gameEngine.setSeed(1);
 
   // add cards to the gameEngine deck
   auto deck = gameEngine.getDeck();
@@ -163,6 +167,42 @@ TEST(OrdersListSuite, listRemoveOrder)
   EXPECT_EQ(list->getList()->size(), originalSize - 2);
 }
 
+TEST(OrdersListSuite, ordersOutsideTheSourceArmiesAreRejected)
+{
+  // arrange
+
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  auto gameEngine = GameEngine(argc, argv, true);
+  gameEngine.loadMap("../res/TestMap1_valid.map");
+  auto player = new Player(&gameEngine, new Hand(), "Rick Astley", "Aggressive");
+
+  auto source = gameEngine.getMap()->getTerritories()->at(0);
+  auto target = source->getAdjacentTerritories()->at(0);
+  player->addTerritory(*source);
+  player->addTerritory(*target);
+  source->setArmies(0);
+  target->setArmies(5);
+
+  // act
+  // e.g. an airlift of all but one army from an empty territory
+  Airlift emptyAirlift(&gameEngine, source, target, player, -1);
+  Airlift largeAirlift(&gameEngine, target, source, player, 6);
+  Advance emptyAdvance(&gameEngine, source, target, player, 0);
+  emptyAirlift.execute();
+  largeAirlift.execute();
+  emptyAdvance.execute();
+
+  // assert
+  EXPECT_FALSE(emptyAirlift.validate());
+  EXPECT_FALSE(largeAirlift.validate());
+  EXPECT_FALSE(emptyAdvance.validate());
+  EXPECT_EQ(source->getArmies(), 0);
+  EXPECT_EQ(target->getArmies(), 5);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
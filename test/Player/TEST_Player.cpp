@@ -2,6 +2,9 @@
 #include <gmock/gmock.h>
 #include "GameEngine/GameEngine.h"
 #include "Player/Player.h"
+#include "Player/MonteCarloSearch.h"
+#include "Player/PlayerStrategies.h"
+#include "GameEngine/QuietConsole.h"
 
 TEST(PlayerTestSuite, PlayerAddTerritories)
 {
@@ -16,10 +19,10 @@ TEST(PlayerTestSuite, PlayerAddTerritories)
   gameEngine.loadMap("res/TestMap1_valid.map");
   auto map_territories = gameEngine.getMap()->getTerritories();
 
-  auto t1 = *map_territories->at(0);
-  auto t2 = *map_territories->at(1);
-  auto t3 = *map_territories->at(2);
-  auto t4 = *map_territories->at(3);
+  auto &t1 = *map_territories->at(0);
+  auto &t2 = *map_territories->at(1);
+  auto &t3 = *map_territories->at(2);
+  auto &t4 = *map_territories->at(3);
 
   // act
   p->addTerritory(t1);
@@ -45,10 +48,10 @@ TEST(PlayerTestSuite, PlayerRemoveTerritories)
   gameEngine.loadMap("res/TestMap1_valid.map");
   auto map_territories = gameEngine.getMap()->getTerritories();
 
-  auto t1 = *map_territories->at(0);
-  auto t2 = *map_territories->at(1);
-  auto t3 = *map_territories->at(2);
-  auto t4 = *map_territories->at(3);
+  auto &t1 = *map_territories->at(0);
+  auto &t2 = *map_territories->at(1);
+  auto &t3 = *map_territories->at(2);
+  auto &t4 = *map_territories->at(3);
 
   p->addTerritory(t1);
   p->addTerritory(t2);
@@ -111,6 +114,267 @@ TEST(PlayerTestSuite, PlayerAttacknDefendTerritories)
   EXPECT_FALSE(attack2.empty());
 }
 
+TEST(PlayerTestSuite, PlayerAttackableSetMatchesAdjacency)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  auto p1 = new Player(&gameEngine, new Hand(), "Bob", "Aggressive");
+  auto p2 = new Player(&gameEngine, new Hand(), "Joe", "Aggressive");
+
+  gameEngine.loadMap("res/TestMap1_valid.map");
+  auto map_territories = gameEngine.getMap()->getTerritories();
+
+  auto first = map_territories->at(0);
+  p1->addTerritory(*first);
+  for (auto adj : *first->getAdjacentTerritories())
+  {
+    p2->addTerritory(*adj);
+  }
+
+  // act
+  auto attackable = p1->getAttackableSet();
+  p1->addFriendly(p2);
+  auto attackableWhileNegotiating = p1->getAttackableSet();
+
+  // assert
+  EXPECT_TRUE(p1->getTerritorySet().test(first->getId()));
+  EXPECT_EQ(p2->getTerritorySet().count(), (int)p2->getTerritories()->size());
+  EXPECT_EQ(attackable.count(), (int)first->getAdjacentTerritories()->size());
+  for (auto adj : *first->getAdjacentTerritories())
+  {
+    EXPECT_TRUE(attackable.test(adj->getId()));
+  }
+  EXPECT_FALSE(attackableWhileNegotiating.any());
+
+  p1->removeTerritory(*first);
+  EXPECT_FALSE(p1->getTerritorySet().any());
+}
+
+TEST(PlayerTestSuite, MonteCarloSearchMergesWorkerStatistics)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  gameEngine.loadMap("res/TestMap1_valid.map");
+  auto p1 = new Player(&gameEngine, new Hand(), "Bob", "MCTS");
+  auto p2 = new Player(&gameEngine, new Hand(), "Joe", "Aggressive");
+
+  auto territories = gameEngine.getMap()->getTerritories();
+  for (int i = 0; i < (int)territories->size(); i++)
+  {
+    territories->at(i)->setArmies(3);
+    (i % 2 == 0 ? p1 : p2)->addTerritory(*territories->at(i));
+  }
+  p1->addReinforcement(6);
+
+  // act
+  MonteCarloSearch search(p1);
+  SearchResult result = search.search(0, 2, 3000, 42);
+  SearchResult again = search.search(0, 1, 500, 7);
+  SearchResult repeat = search.search(0, 1, 500, 7);
+
+  // assert
+  ASSERT_FALSE(search.getActions().empty());
+  EXPECT_EQ(search.getRoot().pool[p1->getId()], 6);
+  EXPECT_EQ(search.getBoard().territoryCount(), (int)territories->size());
+  for (auto &action : search.getActions())
+  {
+    EXPECT_TRUE(p1->getTerritorySet().test(action.source));
+    EXPECT_TRUE(action.target == -1 || p2->getTerritorySet().test(action.target));
+  }
+  EXPECT_EQ(result.rollouts, 3000);
+  long visits = 0;
+  for (int a = 0; a < (int)result.visits.size(); a++)
+  {
+    visits += result.visits[a];
+    EXPECT_GE(result.visits[a], 1);
+    EXPECT_LE(result.values[a], (double)result.visits[a]);
+    EXPECT_LE(result.visits[a], result.visits[result.best]);
+  }
+  EXPECT_EQ(visits, 3000);
+  // a single worker with the same seed searches the same way
+  EXPECT_EQ(again.visits, repeat.visits);
+  EXPECT_EQ(again.best, repeat.best);
+  EXPECT_THROW(search.search(0, 1, 0), std::runtime_error);
+}
+
+TEST(PlayerTestSuite, MCTSIssuesDeployAndAdvanceWithinBudget)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  gameEngine.loadMap("res/TestMap1_valid.map");
+  auto p1 = new Player(&gameEngine, new Hand(), "Bob", "mcts:20");
+  auto p2 = new Player(&gameEngine, new Hand(), "Joe", "Neutral");
+
+  auto territories = gameEngine.getMap()->getTerritories();
+  for (int i = 0; i < (int)territories->size(); i++)
+  {
+    territories->at(i)->setArmies(i % 2 == 0 ? 10 : 1);
+    (i % 2 == 0 ? p1 : p2)->addTerritory(*territories->at(i));
+  }
+  p1->addReinforcement(5);
+
+  // act
+  auto start = std::chrono::steady_clock::now();
+  {
+    QuietConsole quiet;
+    p1->issueOrder();
+  }
+  auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  auto orders = p1->getOrdersListObject()->getList();
+
+  // assert
+  EXPECT_EQ(dynamic_cast<MCTS *>(p1->getStrategy())->getMsPerMove(), 20);
+  EXPECT_EQ(p1->getDeployedArmiesThisTurn(), p1->getReinforcementPool());
+  ASSERT_FALSE(orders->empty());
+  EXPECT_LE(orders->size(), 2u);
+  EXPECT_NE(dynamic_cast<Deploy *>(orders->at(0)), nullptr);
+  if (orders->size() == 2)
+  {
+    EXPECT_NE(dynamic_cast<Advance *>(orders->at(1)), nullptr);
+  }
+  EXPECT_LT(elapsed, 1000);
+  EXPECT_THROW(PlayerStrategy::createStrategy(p1, "mcts:fast"), std::runtime_error);
+  EXPECT_THROW(PlayerStrategy::createStrategy(p1, "mcts:0"), std::runtime_error);
+
+  // tournaments accept the same names as createStrategy
+  EXPECT_TRUE(PlayerStrategy::isStrategyName("mcts:5"));
+  EXPECT_TRUE(PlayerStrategy::isStrategyName("aggressive"));
+  EXPECT_FALSE(PlayerStrategy::isStrategyName("mcts:fast"));
+  gameEngine.allMaps = {"res/TestMap1_valid.map"};
+  gameEngine.allPlayerStrategies = {"mcts:5", "Aggressive"};
+  gameEngine.numberOfGames = 1;
+  gameEngine.maxNumberOfTurns = 10;
+  EXPECT_NO_THROW(gameEngine.validateTournament());
+  gameEngine.allPlayerStrategies = {"mcts:fast", "Aggressive"};
+  EXPECT_THROW(gameEngine.validateTournament(), std::runtime_error);
+}
+
+TEST(PlayerTestSuite, MCTSOutgrowsAggressive)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  QuietConsole quiet;
+  gameEngine.loadMap("res/TestMap1_valid.map");
+  ASSERT_TRUE(gameEngine.validateMap());
+  gameEngine.generateRandomDeck();
+  auto p1 = new Player(&gameEngine, new Hand(), "Bob", "mcts:2");
+  auto p2 = new Player(&gameEngine, new Hand(), "Joe", "Aggressive");
+  gameEngine.assignCardsEvenly();
+  gameEngine.distributeTerritories();
+
+  // act
+  gameEngine.mainGameLoop(30);
+
+  // assert
+  EXPECT_GT(gameEngine.getTerritoryCount(p1), gameEngine.getTerritoryCount(p2));
+}
+
+TEST(PlayerTestSuite, AggressiveMovesArmiesTowardTheFront)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+  gameEngine.loadMap("res/TestMap1_valid.map");
+  auto p1 = new Player(&gameEngine, new Hand(), "Bob", "Aggressive");
+  auto p2 = new Player(&gameEngine, new Hand(), "Joe", "Aggressive");
+  auto map = gameEngine.getMap();
+  auto territories = map->getTerritories();
+  const DistanceOracle &oracle = map->getDistanceOracle();
+
+  // Joe holds a single territory, Bob holds the rest with one big stack as far from it as possible
+  Territory *enemy = territories->at(0);
+  Territory *stack = enemy;
+  for (auto territory : *territories)
+  {
+    if (oracle.distance(territory->getId(), enemy->getId()) > oracle.distance(stack->getId(), enemy->getId()))
+    {
+      stack = territory;
+    }
+  }
+  for (auto territory : *territories)
+  {
+    territory->setArmies(territory == stack ? 20 : 1);
+    (territory == enemy ? p2 : p1)->addTerritory(*territory);
+  }
+  int distanceBefore = oracle.distance(stack->getId(), enemy->getId());
+  Territory *next = territories->at(oracle.nextHop(stack->getId(), enemy->getId()));
+
+  // act
+  // nothing left to deploy, so the player advances; nothing on the front has 3 armies to attack with
+  {
+    QuietConsole quiet;
+    p1->issueOrder();
+    p1->getOrdersListObject()->getList()->at(0)->execute();
+  }
+
+  // assert
+  ASSERT_GE(distanceBefore, 2);
+  EXPECT_EQ(stack->getArmies(), 1);
+  EXPECT_EQ(next->getArmies(), 20);
+  EXPECT_EQ(oracle.distance(next->getId(), enemy->getId()), distanceBefore - 1);
+}
+
+TEST(PlayerTestSuite, NegotiationsLastUntilTheDiplomacyTableIsReset)
+{
+  // arrange
+  // mocking argc and argv
+  int argc = 1;
+  char* argv[] = {(char*)"-console"};
+  GameEngine gameEngine = GameEngine(argc, argv, true);
+
+  auto p1 = new Player(&gameEngine, new Hand(), "Bob", "Aggressive");
+  auto p2 = new Player(&gameEngine, new Hand(), "Joe", "Aggressive");
+  auto p3 = new Player(&gameEngine, new Hand(), "Ann", "Aggressive");
+  auto diplomacy = gameEngine.getDiplomacy();
+
+  // act
+  p1->addFriendly(p2);
+  uint64_t mask = diplomacy->attackableMask(p1->getId());
+
+  // assert
+  EXPECT_EQ(diplomacy->size(), 3);
+  EXPECT_FALSE(p1->canAttack(p1));
+  EXPECT_FALSE(p1->canAttack(p2));
+  EXPECT_FALSE(p2->canAttack(p1));
+  EXPECT_TRUE(p1->canAttack(p3));
+  EXPECT_TRUE(p3->canAttack(p2));
+  EXPECT_TRUE(p1->canAttack(nullptr));
+  EXPECT_TRUE(DiplomacyTable::isAttackable(mask, -1));
+  EXPECT_FALSE(DiplomacyTable::isAttackable(mask, p1->getId()));
+  EXPECT_FALSE(DiplomacyTable::isAttackable(mask, p2->getId()));
+  EXPECT_TRUE(DiplomacyTable::isAttackable(mask, p3->getId()));
+
+  diplomacy->reset();
+  EXPECT_TRUE(p1->canAttack(p2));
+  EXPECT_TRUE(p2->canAttack(p1));
+
+  p3->addFriendly(p1);
+  p3->addFriendly(p2);
+  p3->clearFriendly();
+  EXPECT_TRUE(p1->canAttack(p3));
+  EXPECT_TRUE(p3->canAttack(p2));
+  EXPECT_THROW(diplomacy->resize(DiplomacyTable::MAX_PLAYERS + 1), std::runtime_error);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);